@@ -0,0 +1,81 @@
+// Times delta_stepping against dijkstra on a random graph with uniform
+// lengths, for 1 to hardware_concurrency threads.
+// usage: delta_stepping_bench [nb_vertices] [nb_arcs] [delta]
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "melon/algorithm/delta_stepping.hpp"
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+using namespace fhamonic::melon;
+
+template <typename F>
+double time_seconds(F && f) {
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                         start)
+        .count();
+}
+
+template <typename G, typename L>
+struct bench_dijkstra_traits : public dijkstra_default_traits<G, L> {
+    static constexpr bool store_distances = true;
+};
+
+int main(int argc, char * argv[]) {
+    const std::size_t nb_vertices =
+        argc > 1 ? std::stoul(argv[1]) : std::size_t{1000000};
+    const std::size_t nb_arcs =
+        argc > 2 ? std::stoul(argv[2]) : 8 * nb_vertices;
+    const unsigned max_length = 1000;
+    const unsigned delta = argc > 3 ? static_cast<unsigned>(std::stoul(argv[3]))
+                                    : max_length / 8;
+
+    std::mt19937 engine{42};
+    std::uniform_int_distribution<unsigned> vertex_distr{
+        0u, static_cast<unsigned>(nb_vertices - 1)};
+    std::uniform_int_distribution<unsigned> length_distr{1u, max_length};
+    static_digraph_builder<static_digraph, unsigned> builder(nb_vertices);
+    for(std::size_t i = 0; i < nb_arcs; ++i)
+        builder.add_arc(vertex_distr(engine), vertex_distr(engine),
+                        length_distr(engine));
+    auto [graph, length_map] = builder.build();
+    using G = decltype(graph);
+    using L = decltype(length_map);
+
+    std::cout << nb_vertices << " vertices, " << nb_arcs
+              << " arcs, lengths in [1," << max_length << "], delta = " << delta
+              << std::endl;
+
+    dijkstra<G, L, bench_dijkstra_traits<G, L>> reference(graph, length_map,
+                                                           0u);
+    const double dijkstra_time = time_seconds([&] { reference.run(); });
+    std::cout << "dijkstra            : " << dijkstra_time << " s" << std::endl;
+
+    const std::size_t max_threads =
+        std::max(1u, std::thread::hardware_concurrency());
+    for(std::size_t nb_threads = 1; nb_threads <= max_threads; ++nb_threads) {
+        delta_stepping alg(graph, length_map, delta, 0u,
+                           parallel_policy{nb_threads});
+        const double time = time_seconds([&] { alg.run(); });
+        for(auto && u : vertices(graph)) {
+            if(alg.reached(u) != reference.reached(u) ||
+               (alg.reached(u) && alg.dist(u) != reference.dist(u))) {
+                std::cerr << "wrong distance for vertex " << u << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+        std::cout << "delta_stepping (" << nb_threads
+                  << ") : " << time << " s, speedup " << dijkstra_time / time
+                  << std::endl;
+    }
+    return EXIT_SUCCESS;
+}
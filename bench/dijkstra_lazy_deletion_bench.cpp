@@ -0,0 +1,78 @@
+// Times dijkstra with its default indexed heap against lazy deletion on a
+// sparse and on a dense random graph with uniform lengths.
+// usage: dijkstra_lazy_deletion_bench [nb_queries]
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+using namespace fhamonic::melon;
+
+// Runs a full dijkstra from each source, resetting in between, and returns
+// the elapsed time. checksum receives the sum of the settled distances.
+template <typename T, typename G, typename L>
+double time_queries(const G & graph, const L & length_map,
+                    const std::vector<unsigned> & sources,
+                    std::uint64_t & checksum) {
+    dijkstra<G, L, T> alg(graph, length_map);
+    checksum = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for(auto && s : sources) {
+        alg.reset().add_source(s);
+        for(auto && [u, u_dist] : alg) checksum += u_dist;
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                         start)
+        .count();
+}
+
+bool compare(const std::string & name, const std::size_t nb_vertices,
+             const std::size_t nb_arcs, const std::size_t nb_queries,
+             std::mt19937 & engine) {
+    std::uniform_int_distribution<unsigned> vertex_distr{
+        0u, static_cast<unsigned>(nb_vertices - 1)};
+    std::uniform_int_distribution<unsigned> length_distr{1u, 1000u};
+    static_digraph_builder<static_digraph, unsigned> builder(nb_vertices);
+    for(std::size_t i = 0; i < nb_arcs; ++i)
+        builder.add_arc(vertex_distr(engine), vertex_distr(engine),
+                        length_distr(engine));
+    auto [graph, length_map] = builder.build();
+    using G = decltype(graph);
+    using L = decltype(length_map);
+
+    std::vector<unsigned> sources(nb_queries);
+    for(auto && s : sources) s = vertex_distr(engine);
+
+    std::uint64_t default_checksum, lazy_checksum;
+    const double default_time =
+        time_queries<dijkstra_default_traits<G, L>>(graph, length_map, sources,
+                                                    default_checksum);
+    const double lazy_time = time_queries<dijkstra_lazy_deletion_traits<G, L>>(
+        graph, length_map, sources, lazy_checksum);
+    std::cout << name << " (" << nb_vertices << " vertices, " << nb_arcs
+              << " arcs, " << nb_queries << " queries) : default "
+              << default_time << " s, lazy deletion " << lazy_time
+              << " s, speedup " << default_time / lazy_time << std::endl;
+    return default_checksum == lazy_checksum;
+}
+
+int main(int argc, char * argv[]) {
+    const std::size_t nb_queries =
+        argc > 1 ? std::stoul(argv[1]) : std::size_t{10};
+    std::mt19937 engine{42};
+    bool ok = true;
+    ok &= compare("sparse", 1000000, 4000000, nb_queries, engine);
+    ok &= compare("dense", 2000, 2000000, nb_queries, engine);
+    if(!ok) {
+        std::cerr << "different distances" << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
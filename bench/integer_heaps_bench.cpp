@@ -0,0 +1,141 @@
+// Times dijkstra with radix_heap, dial_heap, d_ary_heap<2> and d_ary_heap<4>
+// on a random integer grid and on a road-like graph.
+// usage: integer_heaps_bench [nb_queries]
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/container/d_ary_heap.hpp"
+#include "melon/container/dial_heap.hpp"
+#include "melon/container/radix_heap.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+#include "random_grid_helper.hpp"
+
+using namespace fhamonic::melon;
+
+template <int D, typename G, typename L>
+struct d_ary_heap_traits : public dijkstra_default_traits<G, L> {
+    using entry_cmp = dijkstra_default_traits<G, L>::entry_cmp;
+    using heap = d_ary_heap<D, vertex_t<G>, mapped_value_t<L, arc_t<G>>,
+                            entry_cmp, vertex_map_t<G, std::size_t>>;
+};
+template <typename G, typename L>
+struct radix_heap_traits : public dijkstra_default_traits<G, L> {
+    using heap = radix_heap<vertex_t<G>, mapped_value_t<L, arc_t<G>>,
+                            vertex_map_t<G, std::size_t>>;
+};
+template <typename G, typename L>
+struct dial_heap_traits : public dijkstra_default_traits<G, L> {
+    using heap = dial_heap<vertex_t<G>, mapped_value_t<L, arc_t<G>>,
+                           vertex_map_t<G, std::size_t>>;
+};
+
+// Runs a full dijkstra from each source, resetting in between, and returns
+// the elapsed time. checksum receives the sum of the settled distances.
+template <typename T, typename G, typename L>
+double time_queries(const G & graph, const L & length_map,
+                    const std::vector<unsigned> & sources,
+                    std::uint64_t & checksum) {
+    dijkstra<G, L, T> alg(graph, length_map);
+    checksum = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for(auto && s : sources) {
+        alg.reset().add_source(s);
+        for(auto && [u, u_dist] : alg) checksum += u_dist;
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                         start)
+        .count();
+}
+
+template <typename G, typename L>
+bool compare(const std::string & name, const G & graph, const L & length_map,
+             const std::size_t nb_queries, std::mt19937 & engine) {
+    std::uniform_int_distribution<unsigned> vertex_distr{
+        0u, static_cast<unsigned>(graph.nb_vertices() - 1)};
+    std::vector<unsigned> sources(nb_queries);
+    for(auto && s : sources) s = vertex_distr(engine);
+
+    std::uint64_t reference_checksum, checksum;
+    const double d2_time = time_queries<d_ary_heap_traits<2, G, L>>(
+        graph, length_map, sources, reference_checksum);
+    const double d4_time = time_queries<d_ary_heap_traits<4, G, L>>(
+        graph, length_map, sources, checksum);
+    bool ok = checksum == reference_checksum;
+    const double radix_time = time_queries<radix_heap_traits<G, L>>(
+        graph, length_map, sources, checksum);
+    ok &= checksum == reference_checksum;
+    const double dial_time = time_queries<dial_heap_traits<G, L>>(
+        graph, length_map, sources, checksum);
+    ok &= checksum == reference_checksum;
+    std::cout << name << " (" << graph.nb_vertices() << " vertices, "
+              << graph.nb_arcs() << " arcs, " << nb_queries
+              << " queries) : d_ary_heap<2> " << d2_time
+              << " s, d_ary_heap<4> " << d4_time << " s, radix_heap "
+              << radix_time << " s, dial_heap " << dial_time << " s"
+              << std::endl;
+    return ok;
+}
+
+// Jittered width x height grid where some streets are missing and every
+// tenth row and column is a road three times faster than the others. Arc
+// lengths are the travel times between the points, in [1, ~500].
+auto road_like_graph(const unsigned width, const unsigned height,
+                     std::mt19937 & engine) {
+    std::uniform_real_distribution<double> jitter_distr{0.0, 60.0};
+    std::bernoulli_distribution keep_distr{0.85};
+    std::vector<double> xs(width * height), ys(width * height);
+    for(unsigned y = 0; y < height; ++y) {
+        for(unsigned x = 0; x < width; ++x) {
+            xs[y * width + x] = 100.0 * x + jitter_distr(engine);
+            ys[y * width + x] = 100.0 * y + jitter_distr(engine);
+        }
+    }
+    static_digraph_builder<static_digraph, unsigned> builder(width * height);
+    auto add_street = [&](const unsigned u, const unsigned v, const bool fast) {
+        const double distance = std::hypot(xs[u] - xs[v], ys[u] - ys[v]);
+        const auto length =
+            static_cast<unsigned>(std::lround(fast ? distance : 3 * distance));
+        builder.add_arc(u, v, length);
+        builder.add_arc(v, u, length);
+    };
+    for(unsigned y = 0; y < height; ++y) {
+        for(unsigned x = 0; x < width; ++x) {
+            const unsigned u = y * width + x;
+            if(x + 1 < width && (y % 10 == 0 || keep_distr(engine)))
+                add_street(u, u + 1, y % 10 == 0);
+            if(y + 1 < height && (x % 10 == 0 || keep_distr(engine)))
+                add_street(u, u + width, x % 10 == 0);
+        }
+    }
+    return builder.build();
+}
+
+int main(int argc, char * argv[]) {
+    const std::size_t nb_queries =
+        argc > 1 ? std::stoul(argv[1]) : std::size_t{10};
+    std::mt19937 engine{42};
+    bool ok = true;
+    {
+        auto [graph, length_map] = random_grid<unsigned>(1000, 1000, 1, 1000);
+        ok &= compare("grid 1000x1000", graph, length_map, nb_queries, engine);
+    }
+    {
+        auto [graph, length_map] = road_like_graph(1000, 1000, engine);
+        ok &= compare("road-like 1000x1000", graph, length_map, nb_queries,
+                      engine);
+    }
+    if(!ok) {
+        std::cerr << "different distances" << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
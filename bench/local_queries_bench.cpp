@@ -0,0 +1,149 @@
+// Times many short-range dijkstra and breadth_first_search queries, with a
+// reset between them, using the default vertex maps, epoch_map and
+// touched_map as resettable vertex maps.
+// usage: local_queries_bench [nb_queries] [nb_settled]
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "melon/algorithm/breadth_first_search.hpp"
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/container/epoch_map.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/container/touched_map.hpp"
+
+#include "random_grid_helper.hpp"
+
+using namespace fhamonic::melon;
+
+template <typename G, typename L>
+struct local_dijkstra_traits : public dijkstra_default_traits<G, L> {
+    static constexpr bool bounded_nb_settled = true;
+};
+template <typename G, typename L>
+struct epoch_dijkstra_traits : public local_dijkstra_traits<G, L> {
+    template <typename K, typename V>
+    using resettable_vertex_map = epoch_map<K, V>;
+};
+template <typename G, typename L>
+struct touched_dijkstra_traits : public local_dijkstra_traits<G, L> {
+    template <typename K, typename V>
+    using resettable_vertex_map = touched_map<K, V>;
+};
+
+struct epoch_bfs_traits : public breadth_first_search_default_traits {
+    template <typename K, typename V>
+    using resettable_vertex_map = epoch_map<K, V>;
+};
+struct touched_bfs_traits : public breadth_first_search_default_traits {
+    template <typename K, typename V>
+    using resettable_vertex_map = touched_map<K, V>;
+};
+
+template <typename F>
+double time_seconds(F && f) {
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                         start)
+        .count();
+}
+
+// checksum receives the sum of the settled distances
+template <typename T, typename G, typename L>
+double time_dijkstra(const G & graph, const L & length_map,
+                     const std::vector<unsigned> & sources,
+                     const std::size_t nb_settled, std::uint64_t & checksum) {
+    dijkstra<G, L, T> alg(graph, length_map);
+    alg.set_max_nb_settled(nb_settled);
+    checksum = 0;
+    return time_seconds([&] {
+        for(auto && s : sources) {
+            alg.reset().add_source(s);
+            for(auto && [u, u_dist] : alg) checksum += u_dist;
+        }
+    });
+}
+
+// checksum receives the sum of the visited vertices
+template <typename T, typename G>
+double time_bfs(const G & graph, const std::vector<unsigned> & sources,
+                const std::size_t nb_settled, std::uint64_t & checksum) {
+    breadth_first_search<G, T> alg(graph);
+    checksum = 0;
+    return time_seconds([&] {
+        for(auto && s : sources) {
+            alg.reset().add_source(s);
+            for(std::size_t i = 0; i < nb_settled && !alg.finished(); ++i) {
+                checksum += alg.current();
+                alg.advance();
+            }
+        }
+    });
+}
+
+void print_times(const std::string & name, const double default_time,
+                 const double epoch_time, const double touched_time) {
+    std::cout << name << " : default " << default_time << " s, epoch_map "
+              << epoch_time << " s, touched_map " << touched_time << " s"
+              << std::endl;
+}
+
+int main(int argc, char * argv[]) {
+    const std::size_t nb_queries =
+        argc > 1 ? std::stoul(argv[1]) : std::size_t{10000};
+    const std::size_t nb_settled =
+        argc > 2 ? std::stoul(argv[2]) : std::size_t{1000};
+
+    auto [graph, length_map] = random_grid<unsigned>(1000, 1000, 1, 1000);
+    using G = decltype(graph);
+    using L = decltype(length_map);
+
+    std::mt19937 engine{42};
+    std::uniform_int_distribution<unsigned> vertex_distr{
+        0u, static_cast<unsigned>(graph.nb_vertices() - 1)};
+    std::vector<unsigned> sources(nb_queries);
+    for(auto && s : sources) s = vertex_distr(engine);
+
+    std::cout << graph.nb_vertices() << " vertices grid, " << nb_queries
+              << " queries settling " << nb_settled << " vertices"
+              << std::endl;
+
+    bool ok = true;
+    std::uint64_t reference_checksum, checksum;
+    {
+        const double default_time =
+            time_dijkstra<local_dijkstra_traits<G, L>>(
+                graph, length_map, sources, nb_settled, reference_checksum);
+        const double epoch_time = time_dijkstra<epoch_dijkstra_traits<G, L>>(
+            graph, length_map, sources, nb_settled, checksum);
+        ok &= checksum == reference_checksum;
+        const double touched_time =
+            time_dijkstra<touched_dijkstra_traits<G, L>>(
+                graph, length_map, sources, nb_settled, checksum);
+        ok &= checksum == reference_checksum;
+        print_times("dijkstra", default_time, epoch_time, touched_time);
+    }
+    {
+        const double default_time =
+            time_bfs<breadth_first_search_default_traits>(
+                graph, sources, nb_settled, reference_checksum);
+        const double epoch_time =
+            time_bfs<epoch_bfs_traits>(graph, sources, nb_settled, checksum);
+        ok &= checksum == reference_checksum;
+        const double touched_time =
+            time_bfs<touched_bfs_traits>(graph, sources, nb_settled, checksum);
+        ok &= checksum == reference_checksum;
+        print_times("breadth_first_search", default_time, epoch_time,
+                    touched_time);
+    }
+    if(!ok) {
+        std::cerr << "different results" << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
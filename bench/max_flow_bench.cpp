@@ -0,0 +1,91 @@
+// Times dinitz against edmonds_karp on a layered network and on a bidirected
+// grid with random capacities.
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include "melon/algorithm/dinitz.hpp"
+#include "melon/algorithm/edmonds_karp.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+using namespace fhamonic::melon;
+
+template <typename A>
+double time_seconds(A && alg, long & flow_value) {
+    const auto start = std::chrono::steady_clock::now();
+    flow_value = alg.run().flow_value();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                         start)
+        .count();
+}
+
+template <typename G, typename C>
+bool compare(const std::string & name, const G & graph, const C & capacity,
+             const unsigned s, const unsigned t) {
+    long edmonds_karp_flow, dinitz_flow;
+    const double edmonds_karp_time = time_seconds(
+        edmonds_karp(graph, capacity, s, t), edmonds_karp_flow);
+    const double dinitz_time =
+        time_seconds(dinitz(graph, capacity, s, t), dinitz_flow);
+    std::cout << name << " : flow " << dinitz_flow << ", edmonds_karp "
+              << edmonds_karp_time << " s, dinitz " << dinitz_time
+              << " s, speedup " << edmonds_karp_time / dinitz_time
+              << std::endl;
+    return edmonds_karp_flow == dinitz_flow;
+}
+
+int main() {
+    std::mt19937 engine{42};
+    std::uniform_int_distribution<long> capacity_distr{1, 1000};
+    bool ok = true;
+
+    {  // layers of vertices with 8 random arcs to the next layer
+        const unsigned nb_layers = 40;
+        const unsigned layer_size = 60;
+        const unsigned s = nb_layers * layer_size;
+        const unsigned t = s + 1;
+        std::uniform_int_distribution<unsigned> layer_distr{0u,
+                                                            layer_size - 1};
+        static_digraph_builder<static_digraph, long> builder(t + 1);
+        for(unsigned v = 0; v < layer_size; ++v) {
+            builder.add_arc(s, v, 1000000);
+            builder.add_arc((nb_layers - 1) * layer_size + v, t, 1000000);
+        }
+        for(unsigned l = 0; l + 1 < nb_layers; ++l)
+            for(unsigned u = 0; u < layer_size; ++u)
+                for(unsigned k = 0; k < 8; ++k)
+                    builder.add_arc(l * layer_size + u,
+                                    (l + 1) * layer_size + layer_distr(engine),
+                                    capacity_distr(engine));
+        auto [graph, capacity] = builder.build();
+        ok &= compare("layered 40x60", graph, capacity, s, t);
+    }
+    {  // bidirected grid from the top left corner to the bottom right one
+        const unsigned width = 150;
+        const unsigned height = 150;
+        static_digraph_builder<static_digraph, long> builder(width * height);
+        for(unsigned y = 0; y < height; ++y) {
+            for(unsigned x = 0; x < width; ++x) {
+                const unsigned u = y * width + x;
+                if(x + 1 < width) {
+                    builder.add_arc(u, u + 1, capacity_distr(engine));
+                    builder.add_arc(u + 1, u, capacity_distr(engine));
+                }
+                if(y + 1 < height) {
+                    builder.add_arc(u, u + width, capacity_distr(engine));
+                    builder.add_arc(u + width, u, capacity_distr(engine));
+                }
+            }
+        }
+        auto [graph, capacity] = builder.build();
+        ok &= compare("grid 150x150", graph, capacity, 0u, width * height - 1);
+    }
+    if(!ok) {
+        std::cerr << "different flow values" << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,585 @@
+#ifndef MELON_ALGORITHM_ALT_HPP
+#define MELON_ALGORITHM_ALT_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <random>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/container/d_ary_heap.hpp"
+#include "melon/container/epoch_map.hpp"
+#include "melon/detail/parallel.hpp"
+#include "melon/graph.hpp"
+#include "melon/utility/value_map.hpp"
+#include "melon/views/reverse.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// clang-format off
+template <typename G, typename L>
+concept alt_graph = outward_incidence_graph<G> && inward_incidence_graph<G> &&
+    has_vertex_map<G> && has_nb_vertices<G> && std::integral<vertex_t<G>> &&
+    input_value_map<L, arc_t<G>> &&
+    std::is_signed_v<mapped_value_t<L, arc_t<G>>>;
+// clang-format on
+
+namespace __detail {
+
+template <typename G, typename L>
+struct alt_dijkstra_traits : public dijkstra_default_traits<G, L> {
+    static constexpr bool store_distances = true;
+    static constexpr bool store_paths = true;
+};
+
+// Distances from s in g, infty for the vertices not reached.
+template <typename G, typename L>
+auto distances_from(const G & g, const L & l, const vertex_t<G> & s) {
+    using value_t = mapped_value_t<L, arc_t<G>>;
+    auto distances = create_vertex_map<value_t>(
+        g, std::numeric_limits<value_t>::max());
+    dijkstra<G, L, alt_dijkstra_traits<G, L>> alg(g, l, s);
+    for(auto && [u, u_dist] : alg) distances[u] = u_dist;
+    return distances;
+}
+
+}  // namespace __detail
+
+// Farthest selection : each landmark is the vertex maximizing the minimum
+// distance from the previous landmarks, the first one being the farthest
+// from first. Vertices not reached by a landmark count as the farthest.
+template <typename G, typename L>
+    requires alt_graph<G, L>
+std::vector<vertex_t<G>> select_farthest_landmarks(
+    const G & g, const L & l, const std::size_t nb_landmarks,
+    const vertex_t<G> & first = vertex_t<G>{0}) {
+    using value_t = mapped_value_t<L, arc_t<G>>;
+    auto min_distances = __detail::distances_from(g, l, first);
+    std::vector<vertex_t<G>> landmarks;
+    for(std::size_t i = 0; i < nb_landmarks; ++i) {
+        vertex_t<G> farthest = first;
+        value_t farthest_dist = -1;
+        for(auto && u : melon::vertices(g)) {
+            if(std::ranges::find(landmarks, u) != landmarks.end()) continue;
+            if(min_distances[u] <= farthest_dist) continue;
+            farthest = u;
+            farthest_dist = min_distances[u];
+        }
+        if(farthest_dist < 0) break;
+        landmarks.push_back(farthest);
+        if(i == 0) min_distances.fill(std::numeric_limits<value_t>::max());
+        const auto distances = __detail::distances_from(g, l, farthest);
+        for(auto && u : melon::vertices(g))
+            min_distances[u] = std::min(min_distances[u], distances[u]);
+    }
+    return landmarks;
+}
+
+// Avoid selection of Goldberg and Werneck : grows a shortest path tree
+// from a random root and weights each vertex by the gap between its
+// distance and the lower bound given by the current landmarks. The size of
+// a vertex is the sum of the weights of its subtree, or 0 if the subtree
+// contains a landmark, and the new landmark is the leaf reached from the
+// root by following the children of maximum size.
+template <typename G, typename L>
+    requires alt_graph<G, L>
+std::vector<vertex_t<G>> select_avoid_landmarks(
+    const G & g, const L & l, const std::size_t nb_landmarks,
+    const std::uint_fast32_t seed = 0) {
+    using vertex = vertex_t<G>;
+    using value_t = mapped_value_t<L, arc_t<G>>;
+    constexpr value_t infty = std::numeric_limits<value_t>::max();
+    const std::size_t n = static_cast<std::size_t>(melon::nb_vertices(g));
+
+    std::mt19937 engine(seed);
+    std::uniform_int_distribution<std::size_t> random_vertex(0, n - 1);
+    std::vector<vertex> landmarks;
+    std::vector<vertex_map_t<G, value_t>> landmark_distances;
+    auto is_landmark = create_vertex_map<bool>(g, false);
+    auto sizes = create_vertex_map<value_t>(g);
+    auto first_child = create_vertex_map<std::optional<vertex>>(g);
+    auto next_sibling = create_vertex_map<std::optional<vertex>>(g);
+    std::vector<vertex> order;
+
+    for(std::size_t i = 0; i < nb_landmarks && i < n; ++i) {
+        const vertex root = static_cast<vertex>(random_vertex(engine));
+        dijkstra<G, L, __detail::alt_dijkstra_traits<G, L>> alg(g, l, root);
+        order.resize(0);
+        for(auto && [u, u_dist] : alg) {
+            order.push_back(u);
+            first_child[u].reset();
+            next_sibling[u].reset();
+        }
+        for(auto && u : order) {
+            value_t lower_bound = 0;
+            for(auto && d : landmark_distances)
+                if(d[root] != infty && d[u] != infty)
+                    lower_bound = std::max(lower_bound, d[u] - d[root]);
+            sizes[u] = alg.dist(u) - lower_bound;
+            if(u == root) continue;
+            const vertex p = alg.pred_vertex(u);
+            next_sibling[u] = first_child[p];
+            first_child[p] = u;
+        }
+        // children come after their parent in order, subtrees containing a
+        // landmark get a negative size
+        for(auto && u : std::views::reverse(order)) {
+            if(is_landmark[u]) sizes[u] = -1;
+            if(u == root) continue;
+            value_t & parent_size = sizes[alg.pred_vertex(u)];
+            if(sizes[u] < 0)
+                parent_size = -1;
+            else if(parent_size >= 0)
+                parent_size += sizes[u];
+        }
+        vertex leaf = root;
+        for(;;) {
+            std::optional<vertex> best_child;
+            for(auto c = first_child[leaf]; c.has_value(); c = next_sibling[*c])
+                if(sizes[*c] > 0 &&
+                   (!best_child.has_value() || sizes[*c] > sizes[*best_child]))
+                    best_child = c;
+            if(!best_child.has_value()) break;
+            leaf = *best_child;
+        }
+        if(is_landmark[leaf]) continue;
+        is_landmark[leaf] = true;
+        landmarks.push_back(leaf);
+        landmark_distances.push_back(__detail::distances_from(g, l, leaf));
+    }
+    return landmarks;
+}
+
+// Distances from and to each landmark, from which the triangle inequality
+// gives lower bounds on the distance between any two vertices. The tables
+// are computed by one dijkstra per landmark and direction, run in parallel.
+template <typename G, typename L>
+    requires alt_graph<G, L>
+class alt_landmarks {
+public:
+    using vertex = vertex_t<G>;
+    using value_t = mapped_value_t<L, arc_t<G>>;
+    using distances_map = vertex_map_t<G, value_t>;
+
+    static constexpr value_t infty = std::numeric_limits<value_t>::max();
+
+private:
+    std::vector<vertex> _landmarks;
+    std::vector<distances_map> _from_landmark;
+    std::vector<distances_map> _to_landmark;
+
+public:
+    template <std::ranges::forward_range R>
+        requires std::convertible_to<std::ranges::range_value_t<R>, vertex>
+    [[nodiscard]] alt_landmarks(const G & g, const L & l, R && landmarks,
+                                const parallel_policy & policy = par)
+        : _landmarks(std::ranges::begin(landmarks),
+                     std::ranges::end(landmarks)) {
+        const std::size_t k = _landmarks.size();
+        _from_landmark.reserve(k);
+        _to_landmark.reserve(k);
+        for(std::size_t i = 0; i < k; ++i) {
+            _from_landmark.emplace_back(create_vertex_map<value_t>(g));
+            _to_landmark.emplace_back(create_vertex_map<value_t>(g));
+        }
+        const views::reverse reverse_graph(g);
+        __detail::parallel_for(policy, 2 * k, [&](const std::size_t i) {
+            if(i < k)
+                _from_landmark[i] =
+                    __detail::distances_from(g, l, _landmarks[i]);
+            else
+                _to_landmark[i - k] = __detail::distances_from(
+                    reverse_graph, l, _landmarks[i - k]);
+        });
+    }
+
+    [[nodiscard]] const std::vector<vertex> & landmarks() const noexcept {
+        return _landmarks;
+    }
+    [[nodiscard]] std::size_t nb_landmarks() const noexcept {
+        return _landmarks.size();
+    }
+    [[nodiscard]] value_t dist_from(const std::size_t i,
+                                    const vertex & u) const noexcept {
+        return _from_landmark[i][u];
+    }
+    [[nodiscard]] value_t dist_to(const std::size_t i,
+                                  const vertex & u) const noexcept {
+        return _to_landmark[i][u];
+    }
+
+    // Lower bound on the distance from u to v, or infty if v is not
+    // reachable from u according to the tables. Terms involving unreached
+    // vertices are skipped, which keeps the bound feasible when used as a
+    // potential toward v or from u.
+    [[nodiscard]] value_t lower_bound(const vertex & u,
+                                      const vertex & v) const noexcept {
+        value_t bound = 0;
+        for(std::size_t i = 0; i < _landmarks.size(); ++i) {
+            const value_t from_u = _from_landmark[i][u];
+            const value_t from_v = _from_landmark[i][v];
+            if(from_u != infty) {
+                if(from_v == infty) return infty;
+                bound = std::max(bound, from_v - from_u);
+            }
+            const value_t to_u = _to_landmark[i][u];
+            const value_t to_v = _to_landmark[i][v];
+            if(to_v != infty) {
+                if(to_u == infty) return infty;
+                bound = std::max(bound, to_u - to_v);
+            }
+        }
+        return bound;
+    }
+};
+
+namespace __detail {
+
+struct alt_entry_cmp {
+    [[nodiscard]] constexpr bool operator()(const auto & e1,
+                                            const auto & e2) const noexcept {
+        return e1.second < e2.second;
+    }
+};
+
+}  // namespace __detail
+
+// A* search from a source to a target with the landmarks lower bounds as
+// potentials : vertices are settled by increasing distance from the source
+// plus lower bound of the distance to the target, which avoids settling
+// the vertices leading away from the target.
+template <typename G, typename L>
+    requires alt_graph<G, L>
+class alt_dijkstra {
+public:
+    using vertex = vertex_t<G>;
+    using arc = arc_t<G>;
+    using value_t = mapped_value_t<L, arc_t<G>>;
+    using landmarks_t = alt_landmarks<G, L>;
+
+    static constexpr value_t infty = landmarks_t::infty;
+
+private:
+    using heap = d_ary_heap<2, vertex, value_t, __detail::alt_entry_cmp>;
+
+    std::reference_wrapper<const G> _graph;
+    std::reference_wrapper<const L> _length_map;
+    std::reference_wrapper<const landmarks_t> _landmarks;
+
+    heap _heap;
+    epoch_map<vertex, value_t> _distances;
+    epoch_map<vertex, value_t> _potentials;
+    epoch_map<vertex, std::optional<arc>> _pred_arcs;
+    std::optional<vertex> _source;
+    std::optional<vertex> _target;
+    std::size_t _nb_settled;
+
+public:
+    [[nodiscard]] alt_dijkstra(const G & g, const L & l,
+                               const landmarks_t & landmarks)
+        : _graph(g)
+        , _length_map(l)
+        , _landmarks(landmarks)
+        , _heap()
+        , _distances(static_cast<std::size_t>(melon::nb_vertices(g)), infty)
+        , _potentials(static_cast<std::size_t>(melon::nb_vertices(g)),
+                      -1)
+        , _pred_arcs(static_cast<std::size_t>(melon::nb_vertices(g)))
+        , _nb_settled(0) {}
+
+    [[nodiscard]] alt_dijkstra(const G & g, const L & l,
+                               const landmarks_t & landmarks, const vertex & s,
+                               const vertex & t)
+        : alt_dijkstra(g, l, landmarks) {
+        add_source(s);
+        add_target(t);
+    }
+
+    alt_dijkstra & reset() noexcept {
+        _heap.clear();
+        _distances.fill(infty);
+        _potentials.fill(-1);
+        _pred_arcs.fill(std::nullopt);
+        _source.reset();
+        _target.reset();
+        _nb_settled = 0;
+        return *this;
+    }
+    alt_dijkstra & add_source(const vertex & s) noexcept {
+        assert(!_source.has_value());
+        _source.emplace(s);
+        return *this;
+    }
+    alt_dijkstra & add_target(const vertex & t) noexcept {
+        assert(!_target.has_value());
+        _target.emplace(t);
+        return *this;
+    }
+
+private:
+    [[nodiscard]] value_t potential(const vertex & u) {
+        value_t & p = _potentials[u];
+        if(p < 0) p = _landmarks.get().lower_bound(u, _target.value());
+        return p;
+    }
+
+public:
+    // Returns the distance from the source to the target, or infty.
+    value_t run() {
+        assert(_source.has_value() && _target.has_value());
+        const G & g = _graph.get();
+        const vertex s = _source.value();
+        const vertex t = _target.value();
+        if(potential(s) == infty) return infty;
+        _distances[s] = 0;
+        _heap.push(s, potential(s));
+        while(!_heap.empty()) {
+            const vertex u = _heap.top().first;
+            _heap.pop();
+            ++_nb_settled;
+            const value_t u_dist = _distances[u];
+            if(u == t) return u_dist;
+            for(auto && a : melon::out_arcs(g, u)) {
+                const vertex w = melon::arc_target(g, a);
+                const value_t new_dist = u_dist + _length_map.get()[a];
+                if(new_dist >= std::as_const(_distances)[w]) continue;
+                const value_t w_potential = potential(w);
+                if(w_potential == infty) continue;
+                if(_heap.contains(w))
+                    _heap.promote(w, new_dist + w_potential);
+                else
+                    _heap.push(w, new_dist + w_potential);
+                _distances[w] = new_dist;
+                _pred_arcs[w] = a;
+            }
+        }
+        return infty;
+    }
+
+    [[nodiscard]] bool path_found() const noexcept {
+        return std::as_const(_distances)[_target.value()] != infty;
+    }
+    [[nodiscard]] std::size_t nb_settled() const noexcept {
+        return _nb_settled;
+    }
+    // Arcs of the shortest path found from the source to the target.
+    [[nodiscard]] std::vector<arc> path() const {
+        assert(path_found());
+        std::vector<arc> arcs;
+        for(vertex u = _target.value();;) {
+            const auto & a = std::as_const(_pred_arcs)[u];
+            if(!a.has_value()) break;
+            arcs.push_back(a.value());
+            u = melon::arc_source(_graph.get(), a.value());
+        }
+        std::ranges::reverse(arcs);
+        return arcs;
+    }
+};
+
+// Bidirectional search with the average potentials of Ikeda et al. : the
+// forward search uses (pi_t - pi_s) / 2 and the reverse search its
+// opposite, where pi_t and pi_s are the landmarks lower bounds of the
+// distances to the target and from the source. Both searches then run on
+// the same reduced lengths, so the stopping criterion is the one of
+// bidirectional_dijkstra. Priorities are doubled to stay integral.
+template <typename G, typename L>
+    requires alt_graph<G, L>
+class alt_bidirectional_dijkstra {
+public:
+    using vertex = vertex_t<G>;
+    using arc = arc_t<G>;
+    using value_t = mapped_value_t<L, arc_t<G>>;
+    using landmarks_t = alt_landmarks<G, L>;
+
+    static constexpr value_t infty = landmarks_t::infty;
+
+private:
+    using heap = d_ary_heap<2, vertex, value_t, __detail::alt_entry_cmp>;
+
+    struct direction {
+        heap queue;
+        epoch_map<vertex, value_t> distances;
+        epoch_map<vertex, std::optional<arc>> pred_arcs;
+
+        explicit direction(const std::size_t n)
+            : queue(), distances(n, infty), pred_arcs(n) {}
+
+        void reset() {
+            queue.clear();
+            distances.fill(infty);
+            pred_arcs.fill(std::nullopt);
+        }
+    };
+
+    std::reference_wrapper<const G> _graph;
+    std::reference_wrapper<const L> _length_map;
+    std::reference_wrapper<const landmarks_t> _landmarks;
+
+    direction _forward;
+    direction _reverse;
+    std::optional<vertex> _source;
+    std::optional<vertex> _target;
+    std::optional<vertex> _midpoint;
+    value_t _st_dist;
+    std::size_t _nb_settled;
+
+public:
+    [[nodiscard]] alt_bidirectional_dijkstra(const G & g, const L & l,
+                                             const landmarks_t & landmarks)
+        : _graph(g)
+        , _length_map(l)
+        , _landmarks(landmarks)
+        , _forward(static_cast<std::size_t>(melon::nb_vertices(g)))
+        , _reverse(static_cast<std::size_t>(melon::nb_vertices(g)))
+        , _st_dist(infty)
+        , _nb_settled(0) {}
+
+    [[nodiscard]] alt_bidirectional_dijkstra(const G & g, const L & l,
+                                             const landmarks_t & landmarks,
+                                             const vertex & s,
+                                             const vertex & t)
+        : alt_bidirectional_dijkstra(g, l, landmarks) {
+        add_source(s);
+        add_target(t);
+    }
+
+    alt_bidirectional_dijkstra & reset() noexcept {
+        _forward.reset();
+        _reverse.reset();
+        _source.reset();
+        _target.reset();
+        _midpoint.reset();
+        _st_dist = infty;
+        _nb_settled = 0;
+        return *this;
+    }
+    alt_bidirectional_dijkstra & add_source(const vertex & s) noexcept {
+        assert(!_source.has_value());
+        _source.emplace(s);
+        return *this;
+    }
+    alt_bidirectional_dijkstra & add_target(const vertex & t) noexcept {
+        assert(!_target.has_value());
+        _target.emplace(t);
+        return *this;
+    }
+
+private:
+    // pi_t(u) - pi_s(u), or nullopt if u cannot be on an s-t path.
+    [[nodiscard]] std::optional<value_t> doubled_potential(
+        const vertex & u) const noexcept {
+        const landmarks_t & landmarks = _landmarks.get();
+        const value_t to_target = landmarks.lower_bound(u, _target.value());
+        const value_t from_source = landmarks.lower_bound(_source.value(), u);
+        if(to_target == infty || from_source == infty) return std::nullopt;
+        return to_target - from_source;
+    }
+
+    template <bool Forward>
+    void advance(direction & d, const direction & other) {
+        const G & g = _graph.get();
+        const vertex u = d.queue.top().first;
+        d.queue.pop();
+        ++_nb_settled;
+        const value_t u_dist = std::as_const(d.distances)[u];
+        const value_t u_other_dist = std::as_const(other.distances)[u];
+        if(u_other_dist != infty && u_dist + u_other_dist < _st_dist) {
+            _st_dist = u_dist + u_other_dist;
+            _midpoint.emplace(u);
+        }
+        auto relax = [&](const arc & a, const vertex & w) {
+            const value_t new_dist = u_dist + _length_map.get()[a];
+            if(new_dist >= std::as_const(d.distances)[w]) return;
+            const auto w_potential = doubled_potential(w);
+            if(!w_potential.has_value()) return;
+            const value_t priority =
+                2 * new_dist + (Forward ? *w_potential : -*w_potential);
+            if(d.queue.contains(w))
+                d.queue.promote(w, priority);
+            else
+                d.queue.push(w, priority);
+            d.distances[w] = new_dist;
+            d.pred_arcs[w] = a;
+            const value_t w_other_dist = std::as_const(other.distances)[w];
+            if(w_other_dist != infty && new_dist + w_other_dist < _st_dist) {
+                _st_dist = new_dist + w_other_dist;
+                _midpoint.emplace(w);
+            }
+        };
+        if constexpr(Forward) {
+            for(auto && a : melon::out_arcs(g, u))
+                relax(a, melon::arc_target(g, a));
+        } else {
+            for(auto && a : melon::in_arcs(g, u))
+                relax(a, melon::arc_source(g, a));
+        }
+    }
+
+    void push_endpoint(direction & d, const vertex & u, const bool forward) {
+        const auto u_potential = doubled_potential(u);
+        if(!u_potential.has_value()) return;
+        d.distances[u] = 0;
+        d.queue.push(u, forward ? *u_potential : -*u_potential);
+    }
+
+public:
+    // Returns the distance from the source to the target, or infty.
+    value_t run() {
+        assert(_source.has_value() && _target.has_value());
+        push_endpoint(_forward, _source.value(), true);
+        push_endpoint(_reverse, _target.value(), false);
+        while(!_forward.queue.empty() && !_reverse.queue.empty()) {
+            const value_t forward_key = _forward.queue.top().second;
+            const value_t reverse_key = _reverse.queue.top().second;
+            if(_st_dist != infty && forward_key + reverse_key >= 2 * _st_dist)
+                break;
+            if(forward_key <= reverse_key)
+                advance<true>(_forward, _reverse);
+            else
+                advance<false>(_reverse, _forward);
+        }
+        return _st_dist;
+    }
+
+    [[nodiscard]] bool path_found() const noexcept {
+        return _midpoint.has_value();
+    }
+    [[nodiscard]] std::size_t nb_settled() const noexcept {
+        return _nb_settled;
+    }
+    // Arcs of the shortest path found from the source to the target.
+    [[nodiscard]] std::vector<arc> path() const {
+        assert(path_found());
+        const G & g = _graph.get();
+        std::vector<arc> arcs;
+        for(vertex u = _midpoint.value();;) {
+            const auto & a = std::as_const(_forward.pred_arcs)[u];
+            if(!a.has_value()) break;
+            arcs.push_back(a.value());
+            u = melon::arc_source(g, a.value());
+        }
+        std::ranges::reverse(arcs);
+        for(vertex u = _midpoint.value();;) {
+            const auto & a = std::as_const(_reverse.pred_arcs)[u];
+            if(!a.has_value()) break;
+            arcs.push_back(a.value());
+            u = melon::arc_target(g, a.value());
+        }
+        return arcs;
+    }
+};
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_ALGORITHM_ALT_HPP
@@ -15,6 +15,7 @@
 
 #include "melon/container/d_ary_heap.hpp"
 #include "melon/detail/constexpr_ternary.hpp"
+#include "melon/detail/resettable_vertex_map.hpp"
 #include "melon/detail/intrusive_view.hpp"
 #include "melon/detail/prefetch.hpp"
 #include "melon/graph.hpp"
@@ -63,8 +64,8 @@ private:
     enum vertex_status : char { PRE_HEAP = 0, IN_HEAP = 1, POST_HEAP = 2 };
 
     using heap = traits::heap;
-    using vertex_status_map =
-        vertex_map_t<G, std::pair<vertex_status, vertex_status>>;
+    using vertex_status_map = __detail::resettable_vertex_map_t<
+        T, G, std::pair<vertex_status, vertex_status>>;
 
     using optional_arc = std::optional<arc>;
     using pred_arcs_map =
@@ -92,9 +93,9 @@ public:
         , _length_map(l)
         , _forward_heap(create_vertex_map<std::size_t>(g))
         , _reverse_heap(create_vertex_map<std::size_t>(g))
-        , _vertex_status_map(g.template create_vertex_map<
-                             std::pair<vertex_status, vertex_status>>(
-              std::make_pair(PRE_HEAP, PRE_HEAP)))
+        , _vertex_status_map(__detail::create_resettable_vertex_map<
+                             T, std::pair<vertex_status, vertex_status>>(
+              g, std::make_pair(PRE_HEAP, PRE_HEAP)))
         , _forward_pred_arcs_map(constexpr_ternary<traits::store_path>(
               create_vertex_map<optional_arc>(g), std::monostate{}))
         , _reverse_pred_arcs_map(constexpr_ternary<traits::store_path>(
@@ -134,6 +135,79 @@ public:
         return *this;
     }
 
+private:
+    constexpr void relax_forward(const value_t & u_dist, const arc & a,
+                                 const vertex & w, const value_t & length,
+                                 value_t & st_dist) noexcept {
+        auto [w_forward_status, w_reverse_status] = _vertex_status_map[w];
+        if(w_forward_status == IN_HEAP) {
+            const value_t new_w_dist = traits::semiring::plus(u_dist, length);
+            if(traits::semiring::less(new_w_dist, _forward_heap.priority(w))) {
+                _forward_heap.promote(w, new_w_dist);
+                if(w_reverse_status == IN_HEAP) {
+                    const value_t new_st_dist =
+                        new_w_dist + _reverse_heap.priority(w);
+                    if(traits::semiring::less(new_st_dist, st_dist)) {
+                        st_dist = new_st_dist;
+                        _midpoint.emplace(w);
+                    }
+                }
+                if constexpr(traits::store_path)
+                    _forward_pred_arcs_map[w].emplace(a);
+            }
+        } else if(w_forward_status == PRE_HEAP) {
+            const value_t new_w_dist = traits::semiring::plus(u_dist, length);
+            _forward_heap.push(w, new_w_dist);
+            _vertex_status_map[w].first = IN_HEAP;
+            if(w_reverse_status == IN_HEAP) {
+                const value_t new_st_dist =
+                    new_w_dist + _reverse_heap.priority(w);
+                if(traits::semiring::less(new_st_dist, st_dist)) {
+                    st_dist = new_st_dist;
+                    _midpoint.emplace(w);
+                }
+            }
+            if constexpr(traits::store_path)
+                _forward_pred_arcs_map[w].emplace(a);
+        }
+    }
+
+    constexpr void relax_reverse(const value_t & u_dist, const arc & a,
+                                 const vertex & w, const value_t & length,
+                                 value_t & st_dist) noexcept {
+        auto [w_forward_status, w_reverse_status] = _vertex_status_map[w];
+        if(w_reverse_status == IN_HEAP) {
+            const value_t new_w_dist = traits::semiring::plus(u_dist, length);
+            if(traits::semiring::less(new_w_dist, _reverse_heap.priority(w))) {
+                _reverse_heap.promote(w, new_w_dist);
+                if(w_forward_status == IN_HEAP) {
+                    const value_t new_st_dist =
+                        new_w_dist + _forward_heap.priority(w);
+                    if(traits::semiring::less(new_st_dist, st_dist)) {
+                        st_dist = new_st_dist;
+                        _midpoint.emplace(w);
+                    }
+                }
+                if constexpr(traits::store_path)
+                    _reverse_pred_arcs_map[w].emplace(a);
+            }
+        } else if(w_reverse_status == PRE_HEAP) {
+            const value_t new_w_dist = traits::semiring::plus(u_dist, length);
+            _reverse_heap.push(w, new_w_dist);
+            _vertex_status_map[w].second = IN_HEAP;
+            if(w_forward_status == IN_HEAP) {
+                const value_t new_st_dist =
+                    new_w_dist + _forward_heap.priority(w);
+                if(traits::semiring::less(new_st_dist, st_dist)) {
+                    st_dist = new_st_dist;
+                    _midpoint.emplace(w);
+                }
+            }
+            if constexpr(traits::store_path)
+                _reverse_pred_arcs_map[w].emplace(a);
+        }
+    }
+
 public:
     constexpr value_t run() noexcept {
         value_t st_dist = traits::semiring::infty;
@@ -150,45 +224,9 @@ public:
                 prefetch_mapped_values(out_arcs_range, _length_map);
                 _vertex_status_map[u1].first = POST_HEAP;
                 _forward_heap.pop();
-                for(const arc a : out_arcs_range) {
-                    const vertex w = arc_target(_graph, a);
-                    auto [w_forward_status, w_reverse_status] =
-                        _vertex_status_map[w];
-                    if(w_forward_status == IN_HEAP) {
-                        const value_t new_w_dist =
-                            traits::semiring::plus(u1_dist, _length_map[a]);
-                        if(traits::semiring::less(new_w_dist,
-                                                  _forward_heap.priority(w))) {
-                            _forward_heap.promote(w, new_w_dist);
-                            if(w_reverse_status == IN_HEAP) {
-                                const value_t new_st_dist =
-                                    new_w_dist + _reverse_heap.priority(w);
-                                if(traits::semiring::less(new_st_dist,
-                                                          st_dist)) {
-                                    st_dist = new_st_dist;
-                                    _midpoint.emplace(w);
-                                }
-                            }
-                            if constexpr(traits::store_path)
-                                _forward_pred_arcs_map[w].emplace(a);
-                        }
-                    } else if(w_forward_status == PRE_HEAP) {
-                        const value_t new_w_dist =
-                            traits::semiring::plus(u1_dist, _length_map[a]);
-                        _forward_heap.push(w, new_w_dist);
-                        _vertex_status_map[w].first = IN_HEAP;
-                        if(w_reverse_status == IN_HEAP) {
-                            const value_t new_st_dist =
-                                new_w_dist + _reverse_heap.priority(w);
-                            if(traits::semiring::less(new_st_dist, st_dist)) {
-                                st_dist = new_st_dist;
-                                _midpoint.emplace(w);
-                            }
-                        }
-                        if constexpr(traits::store_path)
-                            _forward_pred_arcs_map[w].emplace(a);
-                    }
-                }
+                for(const arc a : out_arcs_range)
+                    relax_forward(u1_dist, a, arc_target(_graph, a),
+                                  _length_map[a], st_dist);
             } else {
                 const auto & in_arcs_range = in_arcs(_graph, u2);
                 prefetch_range(in_arcs_range);
@@ -196,45 +234,9 @@ public:
                 prefetch_mapped_values(in_arcs_range, _length_map);
                 _vertex_status_map[u2].second = POST_HEAP;
                 _reverse_heap.pop();
-                for(const arc a : in_arcs_range) {
-                    const vertex w = arc_source(_graph, a);
-                    auto [w_forward_status, w_reverse_status] =
-                        _vertex_status_map[w];
-                    if(w_reverse_status == IN_HEAP) {
-                        const value_t new_w_dist =
-                            traits::semiring::plus(u2_dist, _length_map[a]);
-                        if(traits::semiring::less(new_w_dist,
-                                                  _reverse_heap.priority(w))) {
-                            _reverse_heap.promote(w, new_w_dist);
-                            if(w_forward_status == IN_HEAP) {
-                                const value_t new_st_dist =
-                                    new_w_dist + _forward_heap.priority(w);
-                                if(traits::semiring::less(new_st_dist,
-                                                          st_dist)) {
-                                    st_dist = new_st_dist;
-                                    _midpoint.emplace(w);
-                                }
-                            }
-                            if constexpr(traits::store_path)
-                                _reverse_pred_arcs_map[w].emplace(a);
-                        }
-                    } else if(w_reverse_status == PRE_HEAP) {
-                        const value_t new_w_dist =
-                            traits::semiring::plus(u2_dist, _length_map[a]);
-                        _reverse_heap.push(w, new_w_dist);
-                        _vertex_status_map[w].second = IN_HEAP;
-                        if(w_forward_status == IN_HEAP) {
-                            const value_t new_st_dist =
-                                new_w_dist + _forward_heap.priority(w);
-                            if(traits::semiring::less(new_st_dist, st_dist)) {
-                                st_dist = new_st_dist;
-                                _midpoint.emplace(w);
-                            }
-                        }
-                        if constexpr(traits::store_path)
-                            _reverse_pred_arcs_map[w].emplace(a);
-                    }
-                }
+                for(const arc a : in_arcs_range)
+                    relax_reverse(u2_dist, a, arc_source(_graph, a),
+                                  _length_map[a], st_dist);
             }
         }
         return st_dist;
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "melon/detail/constexpr_ternary.hpp"
+#include "melon/detail/resettable_vertex_map.hpp"
 #include "melon/graph.hpp"
 #include "melon/utility/traversal_iterator.hpp"
 
@@ -35,7 +36,7 @@ public:
         !(outward_adjacency_graph<G> && traits::store_pred_arcs),
         "traversal on outward_adjacency_list cannot access predecessor arcs.");
 
-    using reached_map = vertex_map_t<G, bool>;
+    using reached_map = __detail::resettable_vertex_map_t<T, G, bool>;
     using pred_vertices_map =
         std::conditional<traits::store_pred_vertices, vertex_map_t<G, vertex>,
                          std::monostate>::type;
@@ -60,7 +61,8 @@ public:
     [[nodiscard]] constexpr explicit breadth_first_search(const G & g)
         : _graph(g)
         , _queue()
-        , _reached_map(create_vertex_map<bool>(g, false))
+        , _reached_map(
+              __detail::create_resettable_vertex_map<T, bool>(g, false))
         , _pred_vertices_map(constexpr_ternary<traits::store_pred_vertices>(
               create_vertex_map<vertex>(g), std::monostate{}))
         , _pred_arcs_map(constexpr_ternary<traits::store_pred_arcs>(
@@ -0,0 +1,506 @@
+#ifndef MELON_ALGORITHM_CONTRACTION_HIERARCHY_HPP
+#define MELON_ALGORITHM_CONTRACTION_HIERARCHY_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <functional>
+#include <limits>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "melon/container/d_ary_heap.hpp"
+#include "melon/container/epoch_map.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/container/static_map.hpp"
+#include "melon/graph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+#include "melon/utility/value_map.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Contraction Hierarchies of Geisberger et al. The vertices are contracted
+// one by one in the order of increasing edge difference plus number of
+// contracted neighbors, priorities being updated lazily when popped and
+// when a neighbor is contracted. Contracting v adds a shortcut u -> w for
+// each pair of arcs u -> v -> w unless a witness search, a Dijkstra from u
+// avoiding v and bounded by the length of u -> v -> w and by a number of
+// settled vertices, finds a path at most as short. The arcs of the original
+// graph and the shortcuts are then stored in two static_digraphs : the
+// upward graph holds the arcs u -> w with rank(u) < rank(w) and the
+// downward graph holds the arcs u -> w with rank(u) > rank(w) reversed, so
+// that both searches of a query only go up in the hierarchy.
+template <outward_incidence_graph G, input_value_map<arc_t<G>> L>
+    requires has_nb_vertices<G> && std::unsigned_integral<vertex_t<G>> &&
+             std::is_arithmetic_v<mapped_value_t<L, arc_t<G>>>
+class contraction_hierarchy {
+public:
+    using vertex = vertex_t<G>;
+    using arc = arc_t<G>;
+    using value_t = mapped_value_t<L, arc_t<G>>;
+    // arcs of the search graphs are mapped to the index of their hierarchy
+    // arc, which is either an arc of G or a shortcut
+    using search_graph = basic_static_digraph<vertex, std::size_t>;
+    using lengths_map = std::vector<value_t>;
+    using hierarchy_arcs_map = std::vector<std::size_t>;
+
+    static constexpr value_t infty = std::numeric_limits<value_t>::max();
+
+private:
+    static constexpr std::size_t no_arc =
+        std::numeric_limits<std::size_t>::max();
+
+    struct hierarchy_arc {
+        arc original_arc;
+        std::size_t first_half;  // u -> v of the shortcut u -> v -> w
+        std::size_t second_half;  // v -> w
+    };
+    struct edge {
+        vertex other;
+        value_t length;
+        std::size_t id;
+    };
+    struct shortcut {
+        vertex source;
+        vertex target;
+        value_t length;
+        std::size_t first_half;
+        std::size_t second_half;
+    };
+    struct entry_cmp {
+        [[nodiscard]] constexpr bool operator()(
+            const auto & e1, const auto & e2) const noexcept {
+            return e1.second < e2.second;
+        }
+    };
+
+    std::vector<hierarchy_arc> _hierarchy_arcs;
+    static_map<vertex, std::size_t> _ranks;
+    search_graph _upward_graph;
+    lengths_map _upward_lengths;
+    hierarchy_arcs_map _upward_hierarchy_arcs;
+    search_graph _downward_graph;
+    lengths_map _downward_lengths;
+    hierarchy_arcs_map _downward_hierarchy_arcs;
+
+public:
+    [[nodiscard]] contraction_hierarchy(
+        const G & g, const L & l,
+        const std::size_t witness_settled_limit = 256)
+        : _hierarchy_arcs()
+        , _ranks(static_cast<std::size_t>(melon::nb_vertices(g)))
+        , _upward_graph(0, std::vector<vertex>{}, std::vector<vertex>{})
+        , _downward_graph(0, std::vector<vertex>{}, std::vector<vertex>{}) {
+        contractor(*this, g, l, witness_settled_limit).run();
+    }
+
+    [[nodiscard]] contraction_hierarchy(const contraction_hierarchy &) =
+        default;
+    [[nodiscard]] contraction_hierarchy(contraction_hierarchy &&) = default;
+    contraction_hierarchy & operator=(const contraction_hierarchy &) =
+        default;
+    contraction_hierarchy & operator=(contraction_hierarchy &&) = default;
+
+    [[nodiscard]] std::size_t nb_vertices() const noexcept {
+        return _ranks.size();
+    }
+    // Position of u in the contraction order.
+    [[nodiscard]] std::size_t rank(const vertex & u) const noexcept {
+        return _ranks[u];
+    }
+    [[nodiscard]] std::size_t nb_shortcuts() const noexcept {
+        return static_cast<std::size_t>(std::ranges::count_if(
+            _hierarchy_arcs,
+            [](const hierarchy_arc & a) { return a.first_half != no_arc; }));
+    }
+
+    [[nodiscard]] const search_graph & upward_graph() const noexcept {
+        return _upward_graph;
+    }
+    [[nodiscard]] const lengths_map & upward_lengths() const noexcept {
+        return _upward_lengths;
+    }
+    [[nodiscard]] const hierarchy_arcs_map & upward_hierarchy_arcs()
+        const noexcept {
+        return _upward_hierarchy_arcs;
+    }
+    [[nodiscard]] const search_graph & downward_graph() const noexcept {
+        return _downward_graph;
+    }
+    [[nodiscard]] const lengths_map & downward_lengths() const noexcept {
+        return _downward_lengths;
+    }
+    [[nodiscard]] const hierarchy_arcs_map & downward_hierarchy_arcs()
+        const noexcept {
+        return _downward_hierarchy_arcs;
+    }
+
+    // Calls f on the arcs of G forming the hierarchy arc of index a, in
+    // path order.
+    template <typename F>
+        requires std::invocable<F, const arc &>
+    void unpack(const std::size_t a, F && f) const {
+        std::vector<std::size_t> stack{a};
+        while(!stack.empty()) {
+            const hierarchy_arc & ha = _hierarchy_arcs[stack.back()];
+            stack.pop_back();
+            if(ha.first_half == no_arc) {
+                f(ha.original_arc);
+                continue;
+            }
+            stack.push_back(ha.second_half);
+            stack.push_back(ha.first_half);
+        }
+    }
+
+private:
+    class contractor {
+    private:
+        using heap = d_ary_heap<2, vertex, int, entry_cmp>;
+        using witness_heap = d_ary_heap<2, vertex, value_t, entry_cmp>;
+
+        contraction_hierarchy & _ch;
+        std::size_t _witness_settled_limit;
+        std::size_t _nb_vertices;
+
+        // out and in edges of the current graph, the edges of contracted
+        // vertices are kept to build the search graphs
+        std::vector<std::vector<edge>> _out_edges;
+        std::vector<std::vector<edge>> _in_edges;
+        static_map<vertex, bool> _contracted;
+        static_map<vertex, int> _nb_contracted_neighbors;
+
+        witness_heap _witness_heap;
+        epoch_map<vertex, value_t> _witness_distances;
+        std::vector<shortcut> _shortcuts;
+
+    public:
+        contractor(contraction_hierarchy & ch, const G & g, const L & l,
+                   const std::size_t witness_settled_limit)
+            : _ch(ch)
+            , _witness_settled_limit(witness_settled_limit)
+            , _nb_vertices(static_cast<std::size_t>(melon::nb_vertices(g)))
+            , _out_edges(_nb_vertices)
+            , _in_edges(_nb_vertices)
+            , _contracted(_nb_vertices, false)
+            , _nb_contracted_neighbors(_nb_vertices, 0)
+            , _witness_heap()
+            , _witness_distances(_nb_vertices, infty) {
+            for(auto && a : melon::arcs(g)) {
+                const vertex u = melon::arc_source(g, a);
+                const vertex w = melon::arc_target(g, a);
+                if(u == w) continue;
+                _ch._hierarchy_arcs.push_back(hierarchy_arc{a, no_arc, no_arc});
+                add_edge(u, w, l[a], _ch._hierarchy_arcs.size() - 1);
+            }
+        }
+
+    private:
+        // Adds u -> w or lowers the length of the existing u -> w.
+        void add_edge(const vertex u, const vertex w, const value_t length,
+                      const std::size_t id) {
+            auto out_it = std::ranges::find(_out_edges[u], w, &edge::other);
+            if(out_it == _out_edges[u].end()) {
+                _out_edges[u].push_back(edge{w, length, id});
+                _in_edges[w].push_back(edge{u, length, id});
+                return;
+            }
+            if(out_it->length <= length) return;
+            *out_it = edge{w, length, id};
+            *std::ranges::find(_in_edges[w], u, &edge::other) =
+                edge{u, length, id};
+        }
+
+        // Dijkstra from s on the non contracted vertices except v, stopped
+        // when the distances exceed max_dist or after settling
+        // _witness_settled_limit vertices.
+        void witness_search(const vertex s, const vertex v,
+                            const value_t max_dist) {
+            _witness_distances.fill(infty);
+            _witness_heap.clear();
+            _witness_distances[s] = 0;
+            _witness_heap.push(s, 0);
+            for(std::size_t nb_settled = 0;
+                !_witness_heap.empty() && nb_settled < _witness_settled_limit;
+                ++nb_settled) {
+                const auto [u, u_dist] = _witness_heap.top();
+                if(u_dist > max_dist) break;
+                _witness_heap.pop();
+                for(auto && e : _out_edges[u]) {
+                    if(e.other == v || _contracted[e.other]) continue;
+                    const value_t new_dist = u_dist + e.length;
+                    if(new_dist >= _witness_distances[e.other]) continue;
+                    if(_witness_heap.contains(e.other))
+                        _witness_heap.promote(e.other, new_dist);
+                    else
+                        _witness_heap.push(e.other, new_dist);
+                    _witness_distances[e.other] = new_dist;
+                }
+            }
+        }
+
+        // Fills _shortcuts with the shortcuts needed to contract v.
+        void find_shortcuts(const vertex v) {
+            _shortcuts.resize(0);
+            value_t max_out_length = 0;
+            for(auto && out : _out_edges[v])
+                if(!_contracted[out.other])
+                    max_out_length = std::max(max_out_length, out.length);
+            for(auto && in : _in_edges[v]) {
+                const vertex u = in.other;
+                if(_contracted[u]) continue;
+                witness_search(u, v, in.length + max_out_length);
+                for(auto && out : _out_edges[v]) {
+                    const vertex w = out.other;
+                    if(w == u || _contracted[w]) continue;
+                    const value_t length = in.length + out.length;
+                    if(std::as_const(_witness_distances)[w] <= length)
+                        continue;
+                    _shortcuts.push_back(
+                        shortcut{u, w, length, in.id, out.id});
+                }
+            }
+        }
+
+        [[nodiscard]] int priority(const vertex v) {
+            find_shortcuts(v);
+            int nb_removed_edges = 0;
+            for(auto && e : _out_edges[v])
+                nb_removed_edges += !_contracted[e.other];
+            for(auto && e : _in_edges[v])
+                nb_removed_edges += !_contracted[e.other];
+            return static_cast<int>(_shortcuts.size()) - nb_removed_edges +
+                   _nb_contracted_neighbors[v];
+        }
+
+        void contract(const vertex v) {
+            find_shortcuts(v);
+            for(auto && s : _shortcuts) {
+                _ch._hierarchy_arcs.push_back(
+                    hierarchy_arc{arc{}, s.first_half, s.second_half});
+                add_edge(s.source, s.target, s.length,
+                         _ch._hierarchy_arcs.size() - 1);
+            }
+            _contracted[v] = true;
+        }
+
+        void build_search_graphs() {
+            static_digraph_builder<search_graph, value_t, std::size_t>
+                upward_builder(_nb_vertices);
+            static_digraph_builder<search_graph, value_t, std::size_t>
+                downward_builder(_nb_vertices);
+            for(std::size_t i = 0; i < _nb_vertices; ++i) {
+                const vertex u = static_cast<vertex>(i);
+                for(auto && e : _out_edges[u]) {
+                    if(_ch._ranks[u] < _ch._ranks[e.other])
+                        upward_builder.add_arc(u, e.other, e.length, e.id);
+                    else
+                        downward_builder.add_arc(e.other, u, e.length, e.id);
+                }
+            }
+            std::tie(_ch._upward_graph, _ch._upward_lengths,
+                     _ch._upward_hierarchy_arcs) = upward_builder.build();
+            std::tie(_ch._downward_graph, _ch._downward_lengths,
+                     _ch._downward_hierarchy_arcs) = downward_builder.build();
+        }
+
+    public:
+        void run() {
+            heap order_heap;
+            for(std::size_t i = 0; i < _nb_vertices; ++i)
+                order_heap.push(static_cast<vertex>(i),
+                                priority(static_cast<vertex>(i)));
+            std::size_t rank = 0;
+            while(!order_heap.empty()) {
+                const vertex v = order_heap.top().first;
+                order_heap.pop();
+                // lazy update : v is put back if it is no longer the minimum
+                const int v_priority = priority(v);
+                if(!order_heap.empty() &&
+                   v_priority > order_heap.top().second) {
+                    order_heap.push(v, v_priority);
+                    continue;
+                }
+                contract(v);
+                _ch._ranks[v] = rank++;
+                auto update_neighbor = [&](const vertex w) {
+                    if(_contracted[w]) return;
+                    ++_nb_contracted_neighbors[w];
+                    const int w_priority = priority(w);
+                    if(w_priority < order_heap.priority(w))
+                        order_heap.promote(w, w_priority);
+                };
+                for(auto && e : _out_edges[v]) update_neighbor(e.other);
+                for(auto && e : _in_edges[v]) update_neighbor(e.other);
+            }
+            build_search_graphs();
+        }
+    };
+};
+
+// Point to point query on a contraction_hierarchy : a Dijkstra from the
+// source on the upward graph and a Dijkstra from the target on the
+// downward graph, alternated until the minimum distances in both heaps
+// exceed the length of the shortest path found through a vertex reached
+// by both searches.
+template <typename CH>
+class contraction_hierarchy_query {
+public:
+    using vertex = CH::vertex;
+    using arc = CH::arc;
+    using value_t = CH::value_t;
+
+private:
+    using search_graph = CH::search_graph;
+    using search_arc = arc_t<search_graph>;
+
+    static constexpr value_t infty = CH::infty;
+    static constexpr search_arc no_arc =
+        std::numeric_limits<search_arc>::max();
+
+    struct entry_cmp {
+        [[nodiscard]] constexpr bool operator()(
+            const auto & e1, const auto & e2) const noexcept {
+            return e1.second < e2.second;
+        }
+    };
+    using heap = d_ary_heap<2, vertex, value_t, entry_cmp>;
+
+    struct direction {
+        const search_graph & graph;
+        const typename CH::lengths_map & lengths;
+        heap queue;
+        epoch_map<vertex, value_t> distances;
+        epoch_map<vertex, search_arc> pred_arcs;
+
+        direction(const search_graph & g, const typename CH::lengths_map & l,
+                  const std::size_t n)
+            : graph(g)
+            , lengths(l)
+            , queue()
+            , distances(n, infty)
+            , pred_arcs(n, no_arc) {}
+
+        void reset() {
+            queue.clear();
+            distances.fill(infty);
+            pred_arcs.fill(no_arc);
+        }
+    };
+
+    std::reference_wrapper<const CH> _ch;
+    direction _forward;
+    direction _backward;
+    value_t _st_dist;
+    vertex _midpoint;
+
+public:
+    [[nodiscard]] explicit contraction_hierarchy_query(const CH & ch)
+        : _ch(ch)
+        , _forward(ch.upward_graph(), ch.upward_lengths(), ch.nb_vertices())
+        , _backward(ch.downward_graph(), ch.downward_lengths(),
+                    ch.nb_vertices())
+        , _st_dist(infty)
+        , _midpoint() {}
+
+    [[nodiscard]] contraction_hierarchy_query(const CH & ch, const vertex & s,
+                                              const vertex & t)
+        : contraction_hierarchy_query(ch) {
+        add_source(s);
+        add_target(t);
+    }
+
+    contraction_hierarchy_query & reset() noexcept {
+        _forward.reset();
+        _backward.reset();
+        _st_dist = infty;
+        return *this;
+    }
+    contraction_hierarchy_query & add_source(const vertex & s,
+                                             const value_t dist = 0) {
+        _forward.queue.push(s, dist);
+        _forward.distances[s] = dist;
+        return *this;
+    }
+    contraction_hierarchy_query & add_target(const vertex & t,
+                                             const value_t dist = 0) {
+        _backward.queue.push(t, dist);
+        _backward.distances[t] = dist;
+        return *this;
+    }
+
+private:
+    void advance(direction & d, const direction & other) {
+        const auto [u, u_dist] = d.queue.top();
+        d.queue.pop();
+        const value_t u_other_dist = std::as_const(other.distances)[u];
+        if(u_other_dist != infty && u_dist + u_other_dist < _st_dist) {
+            _st_dist = u_dist + u_other_dist;
+            _midpoint = u;
+        }
+        for(auto && a : melon::out_arcs(d.graph, u)) {
+            const vertex w = melon::arc_target(d.graph, a);
+            const value_t new_dist = u_dist + d.lengths[a];
+            if(new_dist >= std::as_const(d.distances)[w]) continue;
+            if(d.queue.contains(w))
+                d.queue.promote(w, new_dist);
+            else
+                d.queue.push(w, new_dist);
+            d.distances[w] = new_dist;
+            d.pred_arcs[w] = a;
+        }
+    }
+    [[nodiscard]] bool can_improve(const direction & d) const noexcept {
+        return !d.queue.empty() && d.queue.top().second < _st_dist;
+    }
+
+public:
+    // Returns the distance from the sources to the targets, or infty.
+    value_t run() {
+        for(;;) {
+            const bool forward = can_improve(_forward);
+            const bool backward = can_improve(_backward);
+            if(!forward && !backward) break;
+            if(forward && (!backward || _forward.queue.top().second <=
+                                            _backward.queue.top().second))
+                advance(_forward, _backward);
+            else
+                advance(_backward, _forward);
+        }
+        return _st_dist;
+    }
+
+    [[nodiscard]] bool path_found() const noexcept { return _st_dist != infty; }
+
+    // Arcs of the original graph on the shortest path found.
+    [[nodiscard]] std::vector<arc> path() const {
+        assert(path_found());
+        const CH & ch = _ch.get();
+        std::vector<std::size_t> hierarchy_arcs;
+        for(vertex u = _midpoint;;) {
+            const search_arc a = std::as_const(_forward.pred_arcs)[u];
+            if(a == no_arc) break;
+            hierarchy_arcs.push_back(ch.upward_hierarchy_arcs()[a]);
+            u = melon::arc_source(_forward.graph, a);
+        }
+        std::ranges::reverse(hierarchy_arcs);
+        for(vertex u = _midpoint;;) {
+            const search_arc a = std::as_const(_backward.pred_arcs)[u];
+            if(a == no_arc) break;
+            hierarchy_arcs.push_back(ch.downward_hierarchy_arcs()[a]);
+            u = melon::arc_source(_backward.graph, a);
+        }
+        std::vector<arc> arcs;
+        for(auto && ha : hierarchy_arcs)
+            ch.unpack(ha, [&arcs](const arc & a) { arcs.push_back(a); });
+        return arcs;
+    }
+};
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_ALGORITHM_CONTRACTION_HIERARCHY_HPP
@@ -0,0 +1,256 @@
+#ifndef MELON_ALGORITHM_DELTA_STEPPING_HPP
+#define MELON_ALGORITHM_DELTA_STEPPING_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <limits>
+#include <memory>
+#include <ranges>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "melon/detail/parallel.hpp"
+#include "melon/graph.hpp"
+#include "melon/utility/value_map.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Parallel single source shortest paths of Meyer and Sanders. Vertices are
+// kept in buckets of width delta according to their tentative distances.
+// The smallest nonempty bucket is emptied by relaxing the light arcs, of
+// length at most delta, of its vertices until no vertex enters it again,
+// then the heavy arcs of the vertices it contained are relaxed once. Each
+// thread scans chunks of the current bucket, lowers the distances with
+// compare and swaps and pushes the improved vertices in its own buckets,
+// which are merged between phases. Bucket indices are taken modulo the
+// number of buckets, which exceeds the maximum arc length divided by delta.
+// delta = 1 on integer lengths gives Dial's algorithm, a large delta gives
+// Bellman-Ford.
+template <outward_incidence_graph G, input_value_map<arc_t<G>> L>
+    requires has_nb_vertices<G> && std::integral<vertex_t<G>> &&
+             std::is_arithmetic_v<mapped_value_t<L, arc_t<G>>>
+class delta_stepping {
+private:
+    using vertex = vertex_t<G>;
+    using arc = arc_t<G>;
+    using value_t = mapped_value_t<L, arc_t<G>>;
+    using bucket = std::vector<vertex>;
+
+    static constexpr value_t infty = std::numeric_limits<value_t>::max();
+    static constexpr std::size_t chunk_size = 64;
+
+    enum class phase : char { LIGHT, HEAVY, DONE };
+
+    std::reference_wrapper<const G> _graph;
+    std::reference_wrapper<const L> _length_map;
+    value_t _delta;
+    parallel_policy _policy;
+
+    std::unique_ptr<std::atomic<value_t>[]> _distances;
+    // _thread_buckets[t][b] : vertices pushed by thread t in bucket b
+    std::vector<std::vector<bucket>> _thread_buckets;
+    std::size_t _bucket_mask;
+
+    std::size_t _current_bucket;
+    phase _phase;
+    bucket _frontier;
+    bucket _settled;
+    // bucket in which each vertex was last added to _settled
+    std::vector<std::size_t> _settled_bucket;
+    std::atomic<std::size_t> _frontier_cursor;
+
+public:
+    [[nodiscard]] delta_stepping(const G & g, const L & l,
+                                 const value_t & delta,
+                                 const parallel_policy & policy = par)
+        : _graph(g)
+        , _length_map(l)
+        , _delta(delta)
+        , _policy(policy)
+        , _distances(std::make_unique<std::atomic<value_t>[]>(
+              static_cast<std::size_t>(melon::nb_vertices(g))))
+        , _thread_buckets(policy.thread_count())
+        , _current_bucket(0)
+        , _phase(phase::DONE)
+        , _frontier_cursor(0) {
+        assert(delta > 0);
+        value_t max_length = 0;
+        for(auto && a : melon::arcs(g))
+            max_length = std::max(max_length, _length_map.get()[a]);
+        const std::size_t nb_buckets =
+            std::bit_ceil(static_cast<std::size_t>(max_length / delta) + 2);
+        _bucket_mask = nb_buckets - 1;
+        for(auto && buckets : _thread_buckets) buckets.resize(nb_buckets);
+        reset();
+    }
+
+    [[nodiscard]] delta_stepping(const G & g, const L & l,
+                                 const value_t & delta, const vertex & s,
+                                 const parallel_policy & policy = par)
+        : delta_stepping(g, l, delta, policy) {
+        add_source(s);
+    }
+
+    delta_stepping & reset() noexcept {
+        const std::size_t n =
+            static_cast<std::size_t>(melon::nb_vertices(_graph.get()));
+        for(std::size_t u = 0; u < n; ++u)
+            _distances[u].store(infty, std::memory_order_relaxed);
+        _settled_bucket.assign(n, std::numeric_limits<std::size_t>::max());
+        for(auto && buckets : _thread_buckets)
+            for(auto && b : buckets) b.resize(0);
+        _current_bucket = std::numeric_limits<std::size_t>::max();
+        return *this;
+    }
+    delta_stepping & add_source(const vertex & s,
+                                const value_t & dist = 0) noexcept {
+        assert(!reached(s));
+        _distances[static_cast<std::size_t>(s)].store(
+            dist, std::memory_order_relaxed);
+        _thread_buckets[0][bucket_of(dist) & _bucket_mask].push_back(s);
+        _current_bucket = std::min(_current_bucket, bucket_of(dist));
+        return *this;
+    }
+
+private:
+    [[nodiscard]] std::size_t bucket_of(const value_t & d) const noexcept {
+        return static_cast<std::size_t>(d / _delta);
+    }
+    [[nodiscard]] bool is_light(const value_t & length) const noexcept {
+        return length <= _delta;
+    }
+
+    // Moves the vertices of the current bucket of every thread in _frontier.
+    void gather_current_bucket() {
+        _frontier.resize(0);
+        for(auto && buckets : _thread_buckets) {
+            bucket & b = buckets[_current_bucket & _bucket_mask];
+            _frontier.insert(_frontier.end(), b.begin(), b.end());
+            b.resize(0);
+        }
+    }
+    [[nodiscard]] bool find_next_bucket() noexcept {
+        for(std::size_t i = 1; i <= _bucket_mask; ++i) {
+            const std::size_t b = (_current_bucket + i) & _bucket_mask;
+            for(auto && buckets : _thread_buckets) {
+                if(buckets[b].empty()) continue;
+                _current_bucket += i;
+                return true;
+            }
+        }
+        return false;
+    }
+    // Appends to _settled the vertices of _frontier that are in the current
+    // bucket and not yet in _settled, so that the heavy phase relaxes the
+    // arcs of each vertex once despite duplicate and stale bucket entries.
+    void settle_frontier() noexcept {
+        for(auto && u : _frontier) {
+            const std::size_t i = static_cast<std::size_t>(u);
+            if(_settled_bucket[i] == _current_bucket) continue;
+            if(bucket_of(_distances[i].load(std::memory_order_relaxed)) !=
+               _current_bucket)
+                continue;
+            _settled_bucket[i] = _current_bucket;
+            _settled.push_back(u);
+        }
+    }
+    // Chooses the next phase, called by a single thread between phases.
+    void next_phase() {
+        gather_current_bucket();
+        if(!_frontier.empty()) {
+            settle_frontier();
+            _phase = phase::LIGHT;
+        } else if(!_settled.empty()) {
+            _frontier.swap(_settled);
+            _phase = phase::HEAVY;
+        } else {
+            _phase = phase::DONE;
+            if(!find_next_bucket()) return;
+            gather_current_bucket();
+            settle_frontier();
+            _phase = phase::LIGHT;
+        }
+        _frontier_cursor.store(0, std::memory_order_relaxed);
+    }
+
+    void relax(std::vector<bucket> & buckets, const vertex & w,
+               const value_t & new_dist) noexcept {
+        std::atomic<value_t> & w_dist =
+            _distances[static_cast<std::size_t>(w)];
+        value_t old_dist = w_dist.load(std::memory_order_relaxed);
+        while(new_dist < old_dist) {
+            if(w_dist.compare_exchange_weak(old_dist, new_dist,
+                                            std::memory_order_relaxed)) {
+                buckets[bucket_of(new_dist) & _bucket_mask].push_back(w);
+                return;
+            }
+        }
+    }
+    void process_frontier(std::vector<bucket> & buckets) noexcept {
+        const G & g = _graph.get();
+        const L & l = _length_map.get();
+        const bool light = (_phase == phase::LIGHT);
+        for(;;) {
+            const std::size_t begin = _frontier_cursor.fetch_add(
+                chunk_size, std::memory_order_relaxed);
+            if(begin >= _frontier.size()) return;
+            const std::size_t end =
+                std::min(begin + chunk_size, _frontier.size());
+            for(std::size_t i = begin; i < end; ++i) {
+                const vertex u = _frontier[i];
+                const value_t u_dist =
+                    _distances[static_cast<std::size_t>(u)].load(
+                        std::memory_order_relaxed);
+                // u entered the bucket again with a smaller distance
+                if(light && bucket_of(u_dist) != _current_bucket) continue;
+                for(auto && a : melon::out_arcs(g, u)) {
+                    const value_t length = l[a];
+                    if(is_light(length) != light) continue;
+                    relax(buckets, melon::arc_target(g, a), u_dist + length);
+                }
+            }
+        }
+    }
+
+public:
+    void run() {
+        if(_current_bucket == std::numeric_limits<std::size_t>::max()) return;
+        next_phase();
+        if(_phase == phase::DONE) return;
+        const std::size_t nb_threads = _thread_buckets.size();
+        std::barrier sync(static_cast<std::ptrdiff_t>(nb_threads),
+                          [this]() noexcept { next_phase(); });
+        auto work = [&](const std::size_t t) {
+            while(_phase != phase::DONE) {
+                process_frontier(_thread_buckets[t]);
+                sync.arrive_and_wait();
+            }
+        };
+        std::vector<std::jthread> threads;
+        threads.reserve(nb_threads - 1);
+        for(std::size_t t = 1; t < nb_threads; ++t)
+            threads.emplace_back(work, t);
+        work(0);
+    }
+
+    [[nodiscard]] bool reached(const vertex & u) const noexcept {
+        return _distances[static_cast<std::size_t>(u)].load(
+                   std::memory_order_relaxed) != infty;
+    }
+    [[nodiscard]] value_t dist(const vertex & u) const noexcept {
+        assert(reached(u));
+        return _distances[static_cast<std::size_t>(u)].load(
+            std::memory_order_relaxed);
+    }
+};
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_ALGORITHM_DELTA_STEPPING_HPP
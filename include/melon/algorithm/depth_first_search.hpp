@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "melon/detail/constexpr_ternary.hpp"
+#include "melon/detail/resettable_vertex_map.hpp"
 #include "melon/graph.hpp"
 #include "melon/utility/traversal_iterator.hpp"
 
@@ -32,7 +33,7 @@ private:
     using vertex = vertex_t<G>;
     using arc = arc_t<G>;
     using traits = T;
-    using reached_map = vertex_map_t<G, bool>;
+    using reached_map = __detail::resettable_vertex_map_t<T, G, bool>;
 
     static_assert(
         !(outward_adjacency_graph<G> && traits::store_pred_arcs),
@@ -60,7 +61,8 @@ public:
     [[nodiscard]] constexpr explicit depth_first_search(const G & g) noexcept
         : _graph(g)
         , _stack()
-        , _reached_map(create_vertex_map<bool>(g, false))
+        , _reached_map(
+              __detail::create_resettable_vertex_map<T, bool>(g, false))
         , _pred_vertices_map(constexpr_ternary<traits::store_pred_vertices>(
               create_vertex_map<vertex>(g), std::monostate{}))
         , _pred_arcs_map(constexpr_ternary<traits::store_pred_arcs>(
@@ -4,6 +4,8 @@
 #include <algorithm>
 #include <cassert>
 #include <concepts>
+#include <limits>
+#include <optional>
 #include <ranges>
 #include <type_traits>
 #include <utility>
@@ -11,7 +13,9 @@
 #include <vector>
 
 #include "melon/container/d_ary_heap.hpp"
+#include "melon/container/plain_d_ary_heap.hpp"
 #include "melon/detail/constexpr_ternary.hpp"
+#include "melon/detail/resettable_vertex_map.hpp"
 #include "melon/detail/prefetch.hpp"
 #include "melon/graph.hpp"
 #include "melon/utility/priority_queue.hpp"
@@ -22,10 +26,12 @@
 namespace fhamonic {
 namespace melon {
 
+// If T::heap is not an updatable_priority_queue, dijkstra pushes a vertex
+// each time its distance decreases and skips the entries of visited vertices.
 // clang-format off
 template <typename T>
 concept dijkstra_trait = semiring<typename T::semiring> &&
-    updatable_priority_queue<typename T::heap> && requires() {
+    priority_queue<typename T::heap> && requires() {
     { T::store_distances } -> std::convertible_to<bool>;
     { T::store_paths } -> std::convertible_to<bool>;
 };
@@ -45,6 +51,47 @@ struct dijkstra_default_traits {
 
     static constexpr bool store_distances = false;
     static constexpr bool store_paths = false;
+
+    // Stopping criteria, disabled by default to keep their branches out of
+    // the unbounded search : vertices farther than set_distance_bound(d) are
+    // not reached, the search ends once every vertex given to add_target(t)
+    // is settled, resp. once set_max_nb_settled(n) vertices are settled.
+    static constexpr bool bounded_distance = false;
+    static constexpr bool stop_at_targets = false;
+    static constexpr bool bounded_nb_settled = false;
+};
+
+namespace __detail {
+// The stopping criteria are optional members of the traits.
+template <typename T>
+inline constexpr bool dijkstra_bounded_distance = [] {
+    if constexpr(requires { T::bounded_distance; })
+        return static_cast<bool>(T::bounded_distance);
+    else
+        return false;
+}();
+template <typename T>
+inline constexpr bool dijkstra_stop_at_targets = [] {
+    if constexpr(requires { T::stop_at_targets; })
+        return static_cast<bool>(T::stop_at_targets);
+    else
+        return false;
+}();
+template <typename T>
+inline constexpr bool dijkstra_bounded_nb_settled = [] {
+    if constexpr(requires { T::bounded_nb_settled; })
+        return static_cast<bool>(T::bounded_nb_settled);
+    else
+        return false;
+}();
+}  // namespace __detail
+
+// Dijkstra with lazy deletion : cheaper heap operations for more of them.
+template <typename G, typename L>
+struct dijkstra_lazy_deletion_traits : public dijkstra_default_traits<G, L> {
+    using entry_cmp = dijkstra_default_traits<G, L>::entry_cmp;
+    using heap = plain_d_ary_heap<2, vertex_t<G>, mapped_value_t<L, arc_t<G>>,
+                                  entry_cmp>;
 };
 
 template <outward_incidence_graph G, input_value_map<arc_t<G>> L,
@@ -64,7 +111,15 @@ private:
     enum vertex_status : char { PRE_HEAP = 0, IN_HEAP = 1, POST_HEAP = 2 };
 
     using heap = traits::heap;
-    using vertex_status_map = vertex_map_t<G, vertex_status>;
+    static constexpr bool lazy_deletion = !updatable_priority_queue<heap>;
+    static constexpr bool bounded_distance =
+        __detail::dijkstra_bounded_distance<T>;
+    static constexpr bool stop_at_targets =
+        __detail::dijkstra_stop_at_targets<T>;
+    static constexpr bool bounded_nb_settled =
+        __detail::dijkstra_bounded_nb_settled<T>;
+    using vertex_status_map =
+        __detail::resettable_vertex_map_t<T, G, vertex_status>;
     using pred_vertices_map =
         std::conditional<traits::store_paths && !has_arc_source<G>,
                          vertex_map_t<G, vertex>, std::monostate>::type;
@@ -75,6 +130,21 @@ private:
     using distances_map =
         std::conditional<traits::store_distances, vertex_map_t<G, value_t>,
                          std::monostate>::type;
+    using tentative_distances_map =
+        std::conditional<lazy_deletion, vertex_map_t<G, value_t>,
+                         std::monostate>::type;
+    using distance_bound =
+        std::conditional<bounded_distance, value_t, std::monostate>::type;
+    using targets_map =
+        std::conditional<stop_at_targets,
+                         __detail::resettable_vertex_map_t<T, G, bool>,
+                         std::monostate>::type;
+    using settled_count =
+        std::conditional<stop_at_targets || bounded_nb_settled, std::size_t,
+                         std::monostate>::type;
+    using max_settled_count =
+        std::conditional<bounded_nb_settled, std::size_t,
+                         std::monostate>::type;
 
 private:
     std::reference_wrapper<const G> _graph;
@@ -85,13 +155,28 @@ private:
     pred_vertices_map _pred_vertices_map;
     pred_arcs_map _pred_arcs_map;
     distances_map _distances_map;
+    tentative_distances_map _tentative_distances_map;
+    distance_bound _distance_bound;
+    targets_map _targets_map;
+    settled_count _nb_remaining_targets;
+    settled_count _nb_settled;
+    max_settled_count _max_nb_settled;
+
+    [[nodiscard]] static constexpr heap create_heap(const G & g) noexcept {
+        if constexpr(lazy_deletion)
+            return heap();
+        else
+            return heap(create_vertex_map<std::size_t>(g));
+    }
 
 public:
     [[nodiscard]] constexpr dijkstra(const G & g, const L & l)
         : _graph(g)
         , _length_map(l)
-        , _heap(create_vertex_map<std::size_t>(g))
-        , _vertex_status_map(create_vertex_map<vertex_status>(g, PRE_HEAP))
+        , _heap(create_heap(g))
+        , _vertex_status_map(
+              __detail::create_resettable_vertex_map<T, vertex_status>(
+                  g, PRE_HEAP))
         , _pred_vertices_map(
               constexpr_ternary < traits::store_paths &&
               !has_arc_source < G >>
@@ -99,7 +184,18 @@ public:
         , _pred_arcs_map(constexpr_ternary<traits::store_paths>(
               create_vertex_map<optional_arc>(g), std::monostate{}))
         , _distances_map(constexpr_ternary<traits::store_distances>(
-              create_vertex_map<value_t>(g), std::monostate{})) {}
+              create_vertex_map<value_t>(g), std::monostate{}))
+        , _tentative_distances_map(constexpr_ternary<lazy_deletion>(
+              create_vertex_map<value_t>(g), std::monostate{}))
+        , _distance_bound(constexpr_ternary<bounded_distance>(
+              traits::semiring::infty, std::monostate{}))
+        , _targets_map(constexpr_ternary<stop_at_targets>(
+              __detail::create_resettable_vertex_map<T, bool>(g, false),
+              std::monostate{}))
+        , _nb_remaining_targets()
+        , _nb_settled()
+        , _max_nb_settled(constexpr_ternary<bounded_nb_settled>(
+              std::numeric_limits<std::size_t>::max(), std::monostate{})) {}
 
     [[nodiscard]] constexpr dijkstra(const G & g, const L & l, const vertex & s)
         : dijkstra(g, l) {
@@ -115,13 +211,20 @@ public:
     constexpr dijkstra & reset() noexcept {
         _heap.clear();
         _vertex_status_map.fill(PRE_HEAP);
+        if constexpr(stop_at_targets) {
+            _targets_map.fill(false);
+            _nb_remaining_targets = 0;
+        }
+        if constexpr(stop_at_targets || bounded_nb_settled) _nb_settled = 0;
         return *this;
     }
     constexpr dijkstra & add_source(
         const vertex & s,
         const value_t & dist = traits::semiring::zero) noexcept {
         assert(_vertex_status_map[s] != IN_HEAP);
-        _heap.push(s, dist);
+        if constexpr(bounded_distance)
+            if(traits::semiring::less(_distance_bound, dist)) return *this;
+        heap_push(s, dist);
         _vertex_status_map[s] = IN_HEAP;
         if constexpr(traits::store_paths) {
             _pred_arcs_map[s].reset();
@@ -130,7 +233,39 @@ public:
         return *this;
     }
 
+    // The bound and the maximum number of settled vertices are kept by
+    // reset() while the targets are cleared.
+    constexpr dijkstra & set_distance_bound(const value_t & bound) noexcept
+        requires(bounded_distance)
+    {
+        _distance_bound = bound;
+        return *this;
+    }
+    constexpr dijkstra & add_target(const vertex & t) noexcept
+        requires(stop_at_targets)
+    {
+        if(_targets_map[t]) return *this;
+        _targets_map[t] = true;
+        if(_vertex_status_map[t] != POST_HEAP) ++_nb_remaining_targets;
+        return *this;
+    }
+    constexpr dijkstra & set_max_nb_settled(const std::size_t n) noexcept
+        requires(bounded_nb_settled)
+    {
+        _max_nb_settled = n;
+        return *this;
+    }
+    [[nodiscard]] constexpr std::size_t nb_settled() const noexcept
+        requires(stop_at_targets || bounded_nb_settled)
+    {
+        return _nb_settled;
+    }
+
     [[nodiscard]] constexpr bool finished() const noexcept {
+        if constexpr(stop_at_targets)
+            if(_nb_remaining_targets == 0) return true;
+        if constexpr(bounded_nb_settled)
+            if(_nb_settled >= _max_nb_settled) return true;
         return _heap.empty();
     }
 
@@ -139,40 +274,92 @@ public:
         return _heap.top();
     }
 
+private:
+    [[nodiscard]] constexpr value_t heap_priority(
+        const vertex & w) const noexcept {
+        if constexpr(lazy_deletion)
+            return _tentative_distances_map[w];
+        else
+            return _heap.priority(w);
+    }
+    constexpr void heap_promote(const vertex & w,
+                                const value_t & new_dist) noexcept {
+        if constexpr(lazy_deletion) {
+            _heap.push(w, new_dist);
+            _tentative_distances_map[w] = new_dist;
+        } else
+            _heap.promote(w, new_dist);
+    }
+    constexpr void heap_push(const vertex & w,
+                             const value_t & dist) noexcept {
+        _heap.push(w, dist);
+        if constexpr(lazy_deletion) _tentative_distances_map[w] = dist;
+    }
+    // Pops the outdated entries of visited vertices
+    constexpr void discard_visited() noexcept {
+        if constexpr(lazy_deletion)
+            while(!_heap.empty() &&
+                  _vertex_status_map[_heap.top().first] == POST_HEAP)
+                _heap.pop();
+    }
+
+    constexpr void relax(const vertex & t, const value_t & st_dist,
+                         const arc & a, const vertex & w,
+                         const value_t & length) noexcept {
+        const vertex_status & w_status = _vertex_status_map[w];
+        if(w_status == IN_HEAP) {
+            const value_t new_dist = traits::semiring::plus(st_dist, length);
+            if(traits::semiring::less(new_dist, heap_priority(w))) {
+                heap_promote(w, new_dist);
+                if constexpr(traits::store_paths) {
+                    _pred_arcs_map[w].emplace(a);
+                    if constexpr(!has_arc_source<G>) _pred_vertices_map[w] = t;
+                }
+            }
+        } else if(w_status == PRE_HEAP) {
+            const value_t new_dist = traits::semiring::plus(st_dist, length);
+            if constexpr(bounded_distance)
+                if(traits::semiring::less(_distance_bound, new_dist)) return;
+            heap_push(w, new_dist);
+            _vertex_status_map[w] = IN_HEAP;
+            if constexpr(traits::store_paths) {
+                _pred_arcs_map[w].emplace(a);
+                if constexpr(!has_arc_source<G>) _pred_vertices_map[w] = t;
+            }
+        }
+    }
+
+public:
     constexpr void advance() noexcept {
         assert(!finished());
         const auto [t, st_dist] = _heap.top();
         if constexpr(traits::store_distances) _distances_map[t] = st_dist;
         _vertex_status_map[t] = POST_HEAP;
-        const auto & out_arcs_range = melon::out_arcs(_graph.get(), t);
-        prefetch_range(out_arcs_range);
-        prefetch_mapped_values(out_arcs_range, arc_targets_map(_graph.get()));
-        prefetch_mapped_values(out_arcs_range, _length_map.get());
-        _heap.pop();
-        for(const arc & a : out_arcs_range) {
-            const vertex & w = melon::arc_target(_graph.get(), a);
-            const vertex_status & w_status = _vertex_status_map[w];
-            if(w_status == IN_HEAP) {
-                const value_t new_dist =
-                    traits::semiring::plus(st_dist, _length_map.get()[a]);
-                if(traits::semiring::less(new_dist, _heap.priority(w))) {
-                    _heap.promote(w, new_dist);
-                    if constexpr(traits::store_paths) {
-                        _pred_arcs_map[w].emplace(a);
-                        if constexpr(!has_arc_source<G>)
-                            _pred_vertices_map[w] = t;
-                    }
-                }
-            } else if(w_status == PRE_HEAP) {
-                _heap.push(
-                    w, traits::semiring::plus(st_dist, _length_map.get()[a]));
-                _vertex_status_map[w] = IN_HEAP;
-                if constexpr(traits::store_paths) {
-                    _pred_arcs_map[w].emplace(a);
-                    if constexpr(!has_arc_source<G>) _pred_vertices_map[w] = t;
-                }
+        if constexpr(stop_at_targets || bounded_nb_settled) ++_nb_settled;
+        if constexpr(stop_at_targets)
+            if(_targets_map[t]) --_nb_remaining_targets;
+        if constexpr(outward_weighted_adjacency_graph<G, L>) {
+            const auto & out_entries =
+                _graph.get().out_weighted_neighbors(t);
+            prefetch_range(out_entries);
+            _heap.pop();
+            arc a = *std::ranges::begin(melon::out_arcs(_graph.get(), t));
+            for(const auto & [w, length] : out_entries) {
+                relax(t, st_dist, a, w, length);
+                ++a;
             }
+        } else {
+            const auto & out_arcs_range = melon::out_arcs(_graph.get(), t);
+            prefetch_range(out_arcs_range);
+            prefetch_mapped_values(out_arcs_range,
+                                   arc_targets_map(_graph.get()));
+            prefetch_mapped_values(out_arcs_range, _length_map.get());
+            _heap.pop();
+            for(const arc & a : out_arcs_range)
+                relax(t, st_dist, a, melon::arc_target(_graph.get(), a),
+                      _length_map.get()[a]);
         }
+        discard_visited();
     }
 
     constexpr void run() noexcept {
@@ -202,7 +389,7 @@ public:
     {
         assert(reached(u) && _pred_arcs_map[u].has_value());
         if constexpr(has_arc_source<G>)
-            return melon::arc_source(_graph, pred_arc(u));
+            return melon::arc_source(_graph.get(), pred_arc(u));
         else
             return _pred_vertices_map[u];
     }
@@ -211,7 +398,7 @@ public:
         requires(traits::store_distances)
     {
         assert(reached(u) && !visited(u));
-        return _heap.priority(u);
+        return heap_priority(u);
     }
     [[nodiscard]] constexpr value_t dist(const vertex & u) const noexcept
         requires(traits::store_distances)
@@ -0,0 +1,261 @@
+#ifndef MELON_ALGORITHM_DINITZ_HPP
+#define MELON_ALGORITHM_DINITZ_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include "melon/graph.hpp"
+#include "melon/utility/value_map.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Dinitz maximum flow : each phase computes the BFS levels of the residual
+// graph from the source and saturates the level graph with a blocking flow,
+// found by an iterative DFS that keeps a current arc per vertex so that the
+// arcs leading to dead ends are scanned once per phase. The residual arcs
+// of a vertex are its out arcs followed by its in arcs, hence the random
+// access ranges, and only the vertices reached by the last BFS are reset
+// between phases.
+template <graph G, input_value_map<arc_t<G>> C>
+    requires outward_incidence_graph<G> && inward_incidence_graph<G> &&
+             has_vertex_map<G> && has_arc_map<G> && has_nb_vertices<G> &&
+             std::ranges::random_access_range<out_arcs_range_t<G>> &&
+             std::ranges::random_access_range<in_arcs_range_t<G>>
+class dinitz {
+private:
+    using vertex = vertex_t<G>;
+    using arc = arc_t<G>;
+    using value_t = mapped_value_t<C, arc_t<G>>;
+    using out_arcs_difference =
+        std::ranges::range_difference_t<out_arcs_range_t<G>>;
+    using in_arcs_difference =
+        std::ranges::range_difference_t<in_arcs_range_t<G>>;
+
+    static constexpr std::size_t no_level =
+        std::numeric_limits<std::size_t>::max();
+
+private:
+    std::reference_wrapper<const G> _graph;
+    std::reference_wrapper<const C> _capacity_map;
+
+    vertex _s;
+    vertex _t;
+    arc_map_t<G, value_t> _carried_flow_map;
+    arc_map_t<G, value_t> _capacity_left_map;
+
+    std::vector<vertex> _bfs_queue;
+    vertex_map_t<G, std::size_t> _level_map;
+    vertex_map_t<G, std::size_t> _current_arc_map;
+    // arcs of the DFS path with true if used forward
+    std::vector<std::pair<arc, bool>> _dfs_path;
+
+public:
+    [[nodiscard]] constexpr dinitz(const G & g, const C & c)
+        : _graph(g)
+        , _capacity_map(c)
+        , _carried_flow_map(create_arc_map<value_t>(g))
+        , _capacity_left_map(create_arc_map<value_t>(g))
+        , _level_map(create_vertex_map<std::size_t>(g, no_level))
+        , _current_arc_map(create_vertex_map<std::size_t>(g, 0)) {
+        _bfs_queue.reserve(static_cast<std::size_t>(melon::nb_vertices(g)));
+        reset();
+    }
+
+    [[nodiscard]] constexpr dinitz(const G & g, const C & c, const vertex & s,
+                                   const vertex & t)
+        : dinitz(g, c) {
+        set_source(s);
+        set_target(t);
+    }
+
+    [[nodiscard]] constexpr dinitz(const dinitz & bin) = default;
+    [[nodiscard]] constexpr dinitz(dinitz && bin) = default;
+
+    constexpr dinitz & operator=(const dinitz &) = default;
+    constexpr dinitz & operator=(dinitz &&) = default;
+
+    constexpr dinitz & set_source(const vertex & s) noexcept {
+        _s = s;
+        return *this;
+    }
+    constexpr dinitz & set_target(const vertex & t) noexcept {
+        _t = t;
+        return *this;
+    }
+    constexpr dinitz & reset() noexcept {
+        _carried_flow_map.fill(0);
+        for(auto && a : arcs(_graph.get()))
+            _capacity_left_map[a] = _capacity_map.get()[a];
+        for(auto && u : _bfs_queue) _level_map[u] = no_level;
+        _bfs_queue.resize(0);
+        return *this;
+    }
+
+private:
+    [[nodiscard]] constexpr bool reached(const vertex & u) const noexcept {
+        return _level_map[u] != no_level;
+    }
+
+    // Returns true if the target is reached. The BFS stops at the level of
+    // the target since the farther vertices are not in the level graph.
+    bool compute_levels() {
+        for(auto && u : _bfs_queue) _level_map[u] = no_level;
+        _bfs_queue.resize(0);
+        _level_map[_s] = 0;
+        _bfs_queue.push_back(_s);
+        for(std::size_t i = 0; i < _bfs_queue.size(); ++i) {
+            const vertex u = _bfs_queue[i];
+            _current_arc_map[u] = 0;
+            const std::size_t u_level = _level_map[u];
+            if(reached(_t) && u_level >= _level_map[_t]) continue;
+            for(auto && a : out_arcs(_graph.get(), u)) {
+                if(_capacity_left_map[a] == 0) continue;
+                const vertex v = arc_target(_graph.get(), a);
+                if(reached(v)) continue;
+                _level_map[v] = u_level + 1;
+                _bfs_queue.push_back(v);
+            }
+            for(auto && a : in_arcs(_graph.get(), u)) {
+                if(_carried_flow_map[a] == 0) continue;
+                const vertex v = arc_source(_graph.get(), a);
+                if(reached(v)) continue;
+                _level_map[v] = u_level + 1;
+                _bfs_queue.push_back(v);
+            }
+        }
+        return reached(_t);
+    }
+
+    [[nodiscard]] constexpr value_t residual_capacity(
+        const std::pair<arc, bool> & e) const noexcept {
+        return e.second ? _capacity_left_map[e.first]
+                        : _carried_flow_map[e.first];
+    }
+    [[nodiscard]] constexpr vertex residual_source(
+        const std::pair<arc, bool> & e) const noexcept {
+        return e.second ? arc_source(_graph.get(), e.first)
+                        : arc_target(_graph.get(), e.first);
+    }
+
+    [[nodiscard]] constexpr vertex path_end() const noexcept {
+        const auto & [a, forward] = _dfs_path.back();
+        return forward ? arc_target(_graph.get(), a)
+                       : arc_source(_graph.get(), a);
+    }
+
+    // Moves the current arc of u to its next admissible arc and returns true
+    // if there is one.
+    bool find_admissible_arc(const vertex & u, std::pair<arc, bool> & e,
+                             vertex & w) {
+        const auto & u_out_arcs = out_arcs(_graph.get(), u);
+        const auto & u_in_arcs = in_arcs(_graph.get(), u);
+        const std::size_t nb_out_arcs =
+            static_cast<std::size_t>(std::ranges::distance(u_out_arcs));
+        const std::size_t nb_arcs =
+            nb_out_arcs +
+            static_cast<std::size_t>(std::ranges::distance(u_in_arcs));
+        const std::size_t next_level = _level_map[u] + 1;
+        std::size_t & current = _current_arc_map[u];
+        for(; current < nb_out_arcs; ++current) {
+            const arc a = std::ranges::begin(
+                u_out_arcs)[static_cast<out_arcs_difference>(current)];
+            if(_capacity_left_map[a] == 0) continue;
+            w = arc_target(_graph.get(), a);
+            if(_level_map[w] != next_level) continue;
+            e = {a, true};
+            return true;
+        }
+        for(; current < nb_arcs; ++current) {
+            const arc a = std::ranges::begin(u_in_arcs)[static_cast<
+                in_arcs_difference>(current - nb_out_arcs)];
+            if(_carried_flow_map[a] == 0) continue;
+            w = arc_source(_graph.get(), a);
+            if(_level_map[w] != next_level) continue;
+            e = {a, false};
+            return true;
+        }
+        return false;
+    }
+
+    void push_flow_on_path() {
+        value_t pushed_flow = std::numeric_limits<value_t>::max();
+        for(auto && e : _dfs_path)
+            pushed_flow = std::min(pushed_flow, residual_capacity(e));
+        std::size_t first_saturated = _dfs_path.size();
+        for(std::size_t i = 0; i < _dfs_path.size(); ++i) {
+            const auto & [a, forward] = _dfs_path[i];
+            if(forward) {
+                _carried_flow_map[a] += pushed_flow;
+                _capacity_left_map[a] -= pushed_flow;
+            } else {
+                _carried_flow_map[a] -= pushed_flow;
+                _capacity_left_map[a] += pushed_flow;
+            }
+            if(first_saturated == _dfs_path.size() &&
+               residual_capacity(_dfs_path[i]) == 0)
+                first_saturated = i;
+        }
+        // the DFS resumes from the source of the first saturated arc
+        _dfs_path.resize(first_saturated);
+    }
+
+    void push_blocking_flow() {
+        _dfs_path.resize(0);
+        vertex u = _s;
+        for(;;) {
+            if(u == _t) {
+                push_flow_on_path();
+                u = _dfs_path.empty() ? _s : path_end();
+                continue;
+            }
+            std::pair<arc, bool> e;
+            vertex w;
+            if(find_admissible_arc(u, e, w)) {
+                _dfs_path.push_back(e);
+                u = w;
+                continue;
+            }
+            // dead end : retreat and skip the arc that led here
+            if(_dfs_path.empty()) return;
+            u = residual_source(_dfs_path.back());
+            _dfs_path.pop_back();
+            ++_current_arc_map[u];
+        }
+    }
+
+public:
+    // The flow from a vertex to itself is 0, and the target would be reached
+    // at once by each blocking flow search.
+    constexpr dinitz & run() noexcept {
+        if(_s == _t) return *this;
+        while(compute_levels()) push_blocking_flow();
+        return *this;
+    }
+    constexpr value_t flow_value() noexcept {
+        value_t sum{0};
+        for(auto && a : out_arcs(_graph.get(), _s)) sum += _carried_flow_map[a];
+        for(auto && a : in_arcs(_graph.get(), _s)) sum -= _carried_flow_map[a];
+        return sum;
+    }
+    // Arcs leaving the vertices reached by the last BFS, which did not
+    // reach the target.
+    constexpr auto minimum_cut() noexcept {
+        return std::views::join(std::views::transform(
+            _bfs_queue, [this](const vertex_t<G> & v) {
+                return std::views::filter(
+                    out_arcs(_graph.get(), v), [this](const arc_t<G> & a) {
+                        return !reached(arc_target(_graph.get(), a));
+                    });
+            }));
+    }
+};
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_ALGORITHM_DINITZ_HPP
@@ -0,0 +1,267 @@
+#ifndef MELON_ALGORITHM_DIRECTION_OPTIMIZING_BFS_HPP
+#define MELON_ALGORITHM_DIRECTION_OPTIMIZING_BFS_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "melon/detail/constexpr_ternary.hpp"
+#include "melon/detail/parallel.hpp"
+#include "melon/graph.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+struct direction_optimizing_bfs_default_traits {
+    static constexpr bool store_pred_vertices = false;
+    static constexpr bool store_pred_arcs = false;
+    static constexpr bool store_distances = false;
+
+    // Beamer et al. heuristic : switch to bottom-up when the frontier has
+    // more than 1/alpha of the unexplored arcs and back to top-down when it
+    // has less than 1/beta of the vertices.
+    static constexpr std::size_t alpha = 14;
+    static constexpr std::size_t beta = 24;
+};
+
+// Level synchronous breadth first search of Beamer, Asanovic and Patterson.
+// Top-down steps scan the out arcs of the frontier vertices, stored in a
+// vector, while bottom-up steps scan the in arcs of the unreached vertices
+// until finding one from the frontier, stored in a vertex map of bools.
+// Bottom-up steps are the costly ones on low diameter graphs, they run on
+// the threads of the parallel_policy, each thread owning a range of
+// vertices, so that only the reads of the frontier map are shared.
+template <graph G, typename T = direction_optimizing_bfs_default_traits>
+    requires outward_incidence_graph<G> && inward_incidence_graph<G> &&
+             has_vertex_map<G> && has_nb_vertices<G> &&
+             std::integral<vertex_t<G>>
+class direction_optimizing_bfs {
+public:
+    using vertex = vertex_t<G>;
+    using arc = arc_t<G>;
+    using traits = T;
+
+    using bitmap = vertex_map_t<G, bool>;
+    using pred_vertices_map =
+        std::conditional<traits::store_pred_vertices, vertex_map_t<G, vertex>,
+                         std::monostate>::type;
+    using pred_arcs_map =
+        std::conditional<traits::store_pred_arcs, vertex_map_t<G, arc>,
+                         std::monostate>::type;
+    using distances_map =
+        std::conditional<traits::store_distances, vertex_map_t<G, int>,
+                         std::monostate>::type;
+
+private:
+    std::reference_wrapper<const G> _graph;
+    parallel_policy _policy;
+
+    bitmap _reached_map;
+    std::vector<vertex> _frontier;
+    std::vector<vertex> _next_frontier;
+    bitmap _frontier_bitmap;
+    bitmap _next_frontier_bitmap;
+    // number of arcs leaving the frontier, resp. the unreached vertices
+    std::size_t _nb_frontier_arcs;
+    std::size_t _nb_unexplored_arcs;
+
+    pred_vertices_map _pred_vertices_map;
+    pred_arcs_map _pred_arcs_map;
+    distances_map _dist_map;
+
+public:
+    [[nodiscard]] explicit direction_optimizing_bfs(
+        const G & g, const parallel_policy & policy = parallel_policy{1})
+        : _graph(g)
+        , _policy(policy)
+        , _reached_map(create_vertex_map<bool>(g, false))
+        , _frontier()
+        , _next_frontier()
+        , _frontier_bitmap(create_vertex_map<bool>(g, false))
+        , _next_frontier_bitmap(create_vertex_map<bool>(g, false))
+        , _pred_vertices_map(constexpr_ternary<traits::store_pred_vertices>(
+              create_vertex_map<vertex>(g), std::monostate{}))
+        , _pred_arcs_map(constexpr_ternary<traits::store_pred_arcs>(
+              create_vertex_map<arc>(g), std::monostate{}))
+        , _dist_map(constexpr_ternary<traits::store_distances>(
+              create_vertex_map<int>(g), std::monostate{})) {
+        reset();
+    }
+
+    [[nodiscard]] direction_optimizing_bfs(
+        const G & g, const vertex & s,
+        const parallel_policy & policy = parallel_policy{1})
+        : direction_optimizing_bfs(g, policy) {
+        add_source(s);
+    }
+
+    [[nodiscard]] direction_optimizing_bfs(
+        const direction_optimizing_bfs & bin) = default;
+    [[nodiscard]] direction_optimizing_bfs(direction_optimizing_bfs && bin) =
+        default;
+
+    direction_optimizing_bfs & operator=(const direction_optimizing_bfs &) =
+        default;
+    direction_optimizing_bfs & operator=(direction_optimizing_bfs &&) =
+        default;
+
+    direction_optimizing_bfs & reset() noexcept {
+        _reached_map.fill(false);
+        _frontier.resize(0);
+        _nb_frontier_arcs = 0;
+        _nb_unexplored_arcs = static_cast<std::size_t>(
+            std::ranges::distance(melon::arcs(_graph.get())));
+        return *this;
+    }
+    direction_optimizing_bfs & add_source(const vertex & s) noexcept {
+        assert(!_reached_map[s]);
+        _frontier.push_back(s);
+        visit(s);
+        if constexpr(traits::store_pred_vertices) _pred_vertices_map[s] = s;
+        if constexpr(traits::store_distances) _dist_map[s] = 0;
+        _nb_frontier_arcs += out_degree(s);
+        return *this;
+    }
+
+private:
+    [[nodiscard]] std::size_t nb_vertices() const noexcept {
+        return static_cast<std::size_t>(melon::nb_vertices(_graph.get()));
+    }
+    [[nodiscard]] std::size_t out_degree(const vertex & u) const noexcept {
+        return static_cast<std::size_t>(
+            std::ranges::distance(melon::out_arcs(_graph.get(), u)));
+    }
+    void visit(const vertex & u) noexcept {
+        _reached_map[u] = true;
+        _nb_unexplored_arcs -= out_degree(u);
+    }
+
+    void top_down_step(const int level) noexcept {
+        _next_frontier.resize(0);
+        _nb_frontier_arcs = 0;
+        for(auto && u : _frontier) {
+            for(auto && a : melon::out_arcs(_graph.get(), u)) {
+                const vertex w = melon::arc_target(_graph.get(), a);
+                if(_reached_map[w]) continue;
+                visit(w);
+                _next_frontier.push_back(w);
+                _nb_frontier_arcs += out_degree(w);
+                if constexpr(traits::store_pred_vertices)
+                    _pred_vertices_map[w] = u;
+                if constexpr(traits::store_pred_arcs) _pred_arcs_map[w] = a;
+                if constexpr(traits::store_distances) _dist_map[w] = level + 1;
+            }
+        }
+        _frontier.swap(_next_frontier);
+    }
+    // Returns the number of vertices of the next frontier.
+    std::size_t bottom_up_step(const int level) {
+        _next_frontier_bitmap.fill(false);
+        std::vector<std::pair<std::size_t, std::size_t>> block_counts(
+            _policy.thread_count());
+        const std::size_t nb_blocks = __detail::parallel_for_blocks(
+            _policy, nb_vertices(),
+            [&](const std::size_t block, const std::size_t begin,
+                const std::size_t end) {
+                auto & [nb_found, nb_found_arcs] = block_counts[block];
+                for(std::size_t i = begin; i < end; ++i) {
+                    const vertex v = static_cast<vertex>(i);
+                    if(_reached_map[v]) continue;
+                    for(auto && a : melon::in_arcs(_graph.get(), v)) {
+                        const vertex u = melon::arc_source(_graph.get(), a);
+                        if(!_frontier_bitmap[u]) continue;
+                        _reached_map[v] = true;
+                        _next_frontier_bitmap[v] = true;
+                        ++nb_found;
+                        nb_found_arcs += out_degree(v);
+                        if constexpr(traits::store_pred_vertices)
+                            _pred_vertices_map[v] = u;
+                        if constexpr(traits::store_pred_arcs)
+                            _pred_arcs_map[v] = a;
+                        if constexpr(traits::store_distances)
+                            _dist_map[v] = level + 1;
+                        break;
+                    }
+                }
+            });
+        std::size_t nb_found = 0;
+        _nb_frontier_arcs = 0;
+        for(std::size_t b = 0; b < nb_blocks; ++b) {
+            nb_found += block_counts[b].first;
+            _nb_frontier_arcs += block_counts[b].second;
+        }
+        _nb_unexplored_arcs -= _nb_frontier_arcs;
+        std::swap(_frontier_bitmap, _next_frontier_bitmap);
+        return nb_found;
+    }
+
+    void frontier_to_bitmap() noexcept {
+        _frontier_bitmap.fill(false);
+        for(auto && u : _frontier) _frontier_bitmap[u] = true;
+    }
+    void bitmap_to_frontier() noexcept {
+        _frontier.resize(0);
+        const std::size_t n = nb_vertices();
+        for(std::size_t i = 0; i < n; ++i)
+            if(_frontier_bitmap[static_cast<vertex>(i)])
+                _frontier.push_back(static_cast<vertex>(i));
+    }
+
+public:
+    void run() {
+        const std::size_t n = nb_vertices();
+        bool bottom_up = false;
+        std::size_t nb_frontier_vertices = _frontier.size();
+        for(int level = 0; nb_frontier_vertices > 0; ++level) {
+            if(!bottom_up) {
+                if(_nb_frontier_arcs > _nb_unexplored_arcs / traits::alpha) {
+                    frontier_to_bitmap();
+                    bottom_up = true;
+                }
+            } else if(nb_frontier_vertices < n / traits::beta) {
+                bitmap_to_frontier();
+                bottom_up = false;
+            }
+            if(bottom_up) {
+                nb_frontier_vertices = bottom_up_step(level);
+            } else {
+                top_down_step(level);
+                nb_frontier_vertices = _frontier.size();
+            }
+        }
+        _frontier.resize(0);
+        _nb_frontier_arcs = 0;
+    }
+
+    [[nodiscard]] bool reached(const vertex & u) const noexcept {
+        return _reached_map[u];
+    }
+    [[nodiscard]] vertex pred_vertex(const vertex & u) const noexcept
+        requires(traits::store_pred_vertices)
+    {
+        assert(reached(u));
+        return _pred_vertices_map[u];
+    }
+    [[nodiscard]] arc pred_arc(const vertex & u) const noexcept
+        requires(traits::store_pred_arcs)
+    {
+        assert(reached(u));
+        return _pred_arcs_map[u];
+    }
+    [[nodiscard]] int dist(const vertex & u) const noexcept
+        requires(traits::store_distances)
+    {
+        assert(reached(u));
+        return _dist_map[u];
+    }
+};
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_ALGORITHM_DIRECTION_OPTIMIZING_BFS_HPP
@@ -0,0 +1,231 @@
+#ifndef MELON_ALGORITHM_MANY_TO_MANY_HPP
+#define MELON_ALGORITHM_MANY_TO_MANY_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <concepts>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "melon/algorithm/contraction_hierarchy.hpp"
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/detail/parallel.hpp"
+#include "melon/graph.hpp"
+#include "melon/utility/value_map.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Dense row-major matrix of the distances from sources to targets, infty
+// for the unreachable pairs.
+template <typename V>
+class distance_table {
+public:
+    using value_t = V;
+
+    static constexpr value_t infty = std::numeric_limits<value_t>::max();
+
+private:
+    std::size_t _nb_sources;
+    std::size_t _nb_targets;
+    std::vector<value_t> _distances;
+
+public:
+    [[nodiscard]] distance_table(const std::size_t nb_sources,
+                                 const std::size_t nb_targets)
+        : _nb_sources(nb_sources)
+        , _nb_targets(nb_targets)
+        , _distances(nb_sources * nb_targets, infty) {}
+
+    [[nodiscard]] std::size_t nb_sources() const noexcept {
+        return _nb_sources;
+    }
+    [[nodiscard]] std::size_t nb_targets() const noexcept {
+        return _nb_targets;
+    }
+    // Distance from the i-th source to the j-th target.
+    [[nodiscard]] value_t dist(const std::size_t i,
+                               const std::size_t j) const noexcept {
+        assert(i < _nb_sources && j < _nb_targets);
+        return _distances[i * _nb_targets + j];
+    }
+    [[nodiscard]] std::span<value_t> row(const std::size_t i) noexcept {
+        assert(i < _nb_sources);
+        return {_distances.data() + i * _nb_targets, _nb_targets};
+    }
+    [[nodiscard]] std::span<const value_t> row(
+        const std::size_t i) const noexcept {
+        assert(i < _nb_sources);
+        return {_distances.data() + i * _nb_targets, _nb_targets};
+    }
+    [[nodiscard]] const value_t * data() const noexcept {
+        return _distances.data();
+    }
+};
+
+namespace __detail {
+
+// Runs f(workspace, i) for every i in [0, n) on the threads of the policy.
+// Each thread creates one workspace and claims the indices one at a time,
+// since the searches of different sources vary a lot in cost.
+template <typename W, typename F>
+void parallel_for_each_with_workspace(const parallel_policy & policy,
+                                      const std::size_t n, W && make_workspace,
+                                      F && f) {
+    std::atomic<std::size_t> cursor = 0;
+    parallel_for_blocks(policy, n,
+                        [&](std::size_t, std::size_t, std::size_t) {
+                            auto workspace = make_workspace();
+                            for(;;) {
+                                const std::size_t i = cursor.fetch_add(
+                                    1, std::memory_order_relaxed);
+                                if(i >= n) return;
+                                f(workspace, i);
+                            }
+                        });
+}
+
+}  // namespace __detail
+
+// Distances from each source to each target by one dijkstra per source,
+// stopped once every target is settled. The searches run in parallel, each
+// thread reusing the same dijkstra instance for its successive sources.
+template <typename G, typename L, std::ranges::forward_range S,
+          std::ranges::forward_range T>
+    requires outward_incidence_graph<G> && has_vertex_map<G> &&
+             input_value_map<L, arc_t<G>> &&
+             std::convertible_to<std::ranges::range_value_t<S>, vertex_t<G>> &&
+             std::convertible_to<std::ranges::range_value_t<T>, vertex_t<G>>
+[[nodiscard]] distance_table<mapped_value_t<L, arc_t<G>>>
+many_to_many_distances(const G & g, const L & l, S && sources, T && targets,
+                       const parallel_policy & policy = par) {
+    using vertex = vertex_t<G>;
+    constexpr std::size_t no_target = std::numeric_limits<std::size_t>::max();
+
+    const std::vector<vertex> sources_vec(std::ranges::begin(sources),
+                                          std::ranges::end(sources));
+    const std::vector<vertex> targets_vec(std::ranges::begin(targets),
+                                          std::ranges::end(targets));
+    distance_table<mapped_value_t<L, arc_t<G>>> table(sources_vec.size(),
+                                                      targets_vec.size());
+    // indices of the targets at each vertex, chained through next_target
+    auto first_target = create_vertex_map<std::size_t>(g, no_target);
+    std::vector<std::size_t> next_target(targets_vec.size());
+    std::size_t nb_target_vertices = 0;
+    for(std::size_t j = targets_vec.size(); j-- > 0;) {
+        std::size_t & first = first_target[targets_vec[j]];
+        if(first == no_target) ++nb_target_vertices;
+        next_target[j] = first;
+        first = j;
+    }
+    if(nb_target_vertices == 0) return table;
+
+    __detail::parallel_for_each_with_workspace(
+        policy, sources_vec.size(), [&] { return dijkstra(g, l); },
+        [&](auto & alg, const std::size_t i) {
+            auto row = table.row(i);
+            std::size_t nb_remaining = nb_target_vertices;
+            alg.reset();
+            alg.add_source(sources_vec[i]);
+            for(auto && [u, u_dist] : alg) {
+                std::size_t j = first_target[u];
+                if(j == no_target) continue;
+                for(; j != no_target; j = next_target[j]) row[j] = u_dist;
+                if(--nb_remaining == 0) break;
+            }
+        });
+    return table;
+}
+
+// Bucket based many-to-many of Knopp et al. on a contraction_hierarchy :
+// the backward upward search of each target leaves its distance in the
+// bucket of every vertex it settles, then the forward upward search of
+// each source scans the buckets of the vertices it settles. Both phases
+// run in parallel, the buckets being stored contiguously by vertex.
+template <typename CH, std::ranges::forward_range S,
+          std::ranges::forward_range T>
+    requires std::convertible_to<std::ranges::range_value_t<S>,
+                                 typename CH::vertex> &&
+             std::convertible_to<std::ranges::range_value_t<T>,
+                                 typename CH::vertex>
+[[nodiscard]] distance_table<typename CH::value_t>
+contraction_hierarchy_many_to_many(const CH & ch, S && sources, T && targets,
+                                   const parallel_policy & policy = par) {
+    using vertex = CH::vertex;
+    using value_t = CH::value_t;
+    struct bucket_entry {
+        vertex v;
+        std::size_t target_index;
+        value_t dist;
+    };
+
+    const std::vector<vertex> sources_vec(std::ranges::begin(sources),
+                                          std::ranges::end(sources));
+    const std::vector<vertex> targets_vec(std::ranges::begin(targets),
+                                          std::ranges::end(targets));
+    distance_table<value_t> table(sources_vec.size(), targets_vec.size());
+    const auto & upward_graph = ch.upward_graph();
+    const auto & downward_graph = ch.downward_graph();
+
+    std::vector<std::vector<bucket_entry>> thread_entries(
+        policy.thread_count());
+    std::atomic<std::size_t> nb_workspaces = 0;
+    __detail::parallel_for_each_with_workspace(
+        policy, targets_vec.size(),
+        [&] {
+            return std::make_pair(
+                dijkstra(downward_graph, ch.downward_lengths()),
+                &thread_entries[nb_workspaces.fetch_add(1)]);
+        },
+        [&](auto & workspace, const std::size_t j) {
+            auto & [alg, entries] = workspace;
+            alg.reset();
+            alg.add_source(targets_vec[j]);
+            for(auto && [u, u_dist] : alg)
+                entries->emplace_back(u, j, u_dist);
+        });
+
+    // counting sort of the entries by vertex
+    const std::size_t n = ch.nb_vertices();
+    std::vector<std::size_t> bucket_offsets(n + 1, 0);
+    for(auto && entries : thread_entries)
+        for(auto && e : entries) ++bucket_offsets[e.v + 1];
+    for(std::size_t v = 0; v < n; ++v)
+        bucket_offsets[v + 1] += bucket_offsets[v];
+    std::vector<std::pair<std::size_t, value_t>> buckets(bucket_offsets[n]);
+    {
+        std::vector<std::size_t> cursors(bucket_offsets.begin(),
+                                         bucket_offsets.end() - 1);
+        for(auto && entries : thread_entries) {
+            for(auto && e : entries)
+                buckets[cursors[e.v]++] = {e.target_index, e.dist};
+            std::vector<bucket_entry>().swap(entries);
+        }
+    }
+
+    __detail::parallel_for_each_with_workspace(
+        policy, sources_vec.size(),
+        [&] { return dijkstra(upward_graph, ch.upward_lengths()); },
+        [&](auto & alg, const std::size_t i) {
+            auto row = table.row(i);
+            alg.reset();
+            alg.add_source(sources_vec[i]);
+            for(auto && [u, u_dist] : alg) {
+                for(std::size_t k = bucket_offsets[u];
+                    k < bucket_offsets[u + 1]; ++k) {
+                    const auto & [j, t_dist] = buckets[k];
+                    row[j] = std::min(row[j], u_dist + t_dist);
+                }
+            }
+        });
+    return table;
+}
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_ALGORITHM_MANY_TO_MANY_HPP
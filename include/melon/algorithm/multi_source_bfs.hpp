@@ -0,0 +1,210 @@
+#ifndef MELON_ALGORITHM_MULTI_SOURCE_BFS_HPP
+#define MELON_ALGORITHM_MULTI_SOURCE_BFS_HPP
+
+#include <array>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "melon/graph.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+struct multi_source_bfs_default_traits {
+    static constexpr bool store_distances = false;
+};
+
+namespace __detail {
+
+// Set of B sources stored in B/64 words. The operators are plain loops over
+// the words that compilers turn into vector instructions when B > 64.
+template <std::size_t B>
+    requires(B > 0 && B % 64 == 0)
+struct sources_mask {
+    using word_type = std::uint64_t;
+    static constexpr std::size_t nb_words = B / 64;
+
+    std::array<word_type, nb_words> words{};
+
+    [[nodiscard]] constexpr bool test(const std::size_t i) const noexcept {
+        return (words[i / 64] >> (i % 64)) & 1;
+    }
+    constexpr void set(const std::size_t i) noexcept {
+        words[i / 64] |= word_type(1) << (i % 64);
+    }
+    constexpr void clear() noexcept { words.fill(0); }
+    [[nodiscard]] constexpr bool any() const noexcept {
+        word_type acc = 0;
+        for(std::size_t w = 0; w < nb_words; ++w) acc |= words[w];
+        return acc != 0;
+    }
+    [[nodiscard]] constexpr bool none() const noexcept { return !any(); }
+    [[nodiscard]] constexpr std::size_t count() const noexcept {
+        std::size_t c = 0;
+        for(auto && word : words)
+            c += static_cast<std::size_t>(std::popcount(word));
+        return c;
+    }
+    constexpr sources_mask & operator|=(const sources_mask & o) noexcept {
+        for(std::size_t w = 0; w < nb_words; ++w) words[w] |= o.words[w];
+        return *this;
+    }
+    // this = this & ~o
+    constexpr sources_mask & remove(const sources_mask & o) noexcept {
+        for(std::size_t w = 0; w < nb_words; ++w) words[w] &= ~o.words[w];
+        return *this;
+    }
+    // Calls f(i) for each source i of the mask in increasing order.
+    template <typename F>
+    constexpr void for_each(F && f) const {
+        for(std::size_t w = 0; w < nb_words; ++w) {
+            for(word_type word = words[w]; word != 0; word &= word - 1)
+                f(w * 64 + static_cast<std::size_t>(std::countr_zero(word)));
+        }
+    }
+};
+
+}  // namespace __detail
+
+// Multi-source BFS of Then et al. : runs the breadth first searches from up
+// to B sources at once. Each vertex holds the set of sources that reached
+// it and the set of sources whose frontier contains it, so that a single
+// scan of the out neighbors of a vertex advances all these searches. Levels
+// are synchronous : the frontier sets are propagated to the neighbors, then
+// the sources that already reached a vertex are removed from its next
+// frontier set. run(f) calls f(v, mask, d) on the vertices v reached at
+// distance d by the sources in mask, which provides test(i), count() and
+// for_each(f).
+template <outward_adjacency_graph G, std::size_t B = 64,
+          typename T = multi_source_bfs_default_traits>
+    requires has_vertex_map<G> && (B > 0 && B % 64 == 0)
+class multi_source_bfs {
+public:
+    using vertex = vertex_t<G>;
+    using traits = T;
+    using mask = __detail::sources_mask<B>;
+    using masks_map = vertex_map_t<G, mask>;
+    using distances_maps =
+        std::conditional<traits::store_distances,
+                         std::vector<vertex_map_t<G, int>>,
+                         std::monostate>::type;
+
+    static constexpr std::size_t max_nb_sources = B;
+
+private:
+    std::reference_wrapper<const G> _graph;
+    std::size_t _nb_sources;
+    masks_map _seen;
+    masks_map _visit;
+    masks_map _visit_next;
+    distances_maps _distances;
+
+public:
+    [[nodiscard]] explicit multi_source_bfs(const G & g)
+        : _graph(g)
+        , _nb_sources(0)
+        , _seen(create_vertex_map<mask>(g, mask{}))
+        , _visit(create_vertex_map<mask>(g, mask{}))
+        , _visit_next(create_vertex_map<mask>(g, mask{}))
+        , _distances() {}
+
+    template <std::ranges::input_range R>
+        requires std::convertible_to<std::ranges::range_value_t<R>, vertex>
+    [[nodiscard]] multi_source_bfs(const G & g, R && sources)
+        : multi_source_bfs(g) {
+        for(auto && s : sources) add_source(s);
+    }
+
+    multi_source_bfs & reset() noexcept {
+        _nb_sources = 0;
+        for(auto && v : melon::vertices(_graph.get())) {
+            _seen[v].clear();
+            _visit[v].clear();
+        }
+        if constexpr(traits::store_distances) _distances.resize(0);
+        return *this;
+    }
+    // The i-th added source has index i.
+    multi_source_bfs & add_source(const vertex & s) {
+        assert(_nb_sources < max_nb_sources);
+        _seen[s].set(_nb_sources);
+        _visit[s].set(_nb_sources);
+        if constexpr(traits::store_distances) {
+            _distances.emplace_back(create_vertex_map<int>(_graph.get(), -1));
+            _distances.back()[s] = 0;
+        }
+        ++_nb_sources;
+        return *this;
+    }
+    [[nodiscard]] std::size_t nb_sources() const noexcept {
+        return _nb_sources;
+    }
+
+    template <typename F>
+        requires std::invocable<F, const vertex &, const mask &, int>
+    void run(F && on_visit) {
+        const G & g = _graph.get();
+        for(auto && v : melon::vertices(g))
+            if(_visit[v].any()) on_visit(v, std::as_const(_visit[v]), 0);
+        for(int level = 1;; ++level) {
+            for(auto && u : melon::vertices(g)) {
+                const mask & u_visit = _visit[u];
+                if(u_visit.none()) continue;
+                for(auto && w : melon::out_neighbors(g, u))
+                    _visit_next[w] |= u_visit;
+            }
+            bool active = false;
+            for(auto && v : melon::vertices(g)) {
+                _visit[v].clear();
+                mask & next = _visit_next[v];
+                if(next.none()) continue;
+                next.remove(_seen[v]);
+                if(next.none()) continue;
+                _seen[v] |= next;
+                active = true;
+                if constexpr(traits::store_distances)
+                    next.for_each([&](const std::size_t i) {
+                        _distances[i][v] = level;
+                    });
+                on_visit(v, std::as_const(next), level);
+            }
+            // _visit is cleared and becomes the next frontier sets
+            std::swap(_visit, _visit_next);
+            if(!active) return;
+        }
+    }
+    void run() {
+        run([](const vertex &, const mask &, int) noexcept {});
+    }
+
+    [[nodiscard]] bool reached(const std::size_t i,
+                               const vertex & u) const noexcept {
+        assert(i < _nb_sources);
+        return _seen[u].test(i);
+    }
+    // Sources that reached u.
+    [[nodiscard]] const mask & reached_sources(
+        const vertex & u) const noexcept {
+        return _seen[u];
+    }
+    [[nodiscard]] int dist(const std::size_t i,
+                           const vertex & u) const noexcept
+        requires(traits::store_distances)
+    {
+        assert(reached(i, u));
+        return _distances[i][u];
+    }
+};
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_ALGORITHM_MULTI_SOURCE_BFS_HPP
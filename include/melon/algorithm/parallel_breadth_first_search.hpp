@@ -0,0 +1,190 @@
+#ifndef MELON_ALGORITHM_PARALLEL_BFS_HPP
+#define MELON_ALGORITHM_PARALLEL_BFS_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <cassert>
+#include <concepts>
+#include <ranges>
+#include <thread>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#include "melon/algorithm/breadth_first_search.hpp"
+#include "melon/container/static_map.hpp"
+#include "melon/detail/constexpr_ternary.hpp"
+#include "melon/detail/parallel.hpp"
+#include "melon/graph.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Level synchronous breadth first search. Threads claim chunks of the
+// current frontier and discover the targets of their out arcs with a
+// test_and_set on an atomic bitmap, so that each vertex is claimed by a
+// single thread, which alone writes its predecessor and distance. Claimed
+// vertices are pushed in the next frontier of the thread and the next
+// frontiers are concatenated between levels. Takes the same traits as
+// breadth_first_search.
+template <outward_incidence_graph G,
+          typename T = breadth_first_search_default_traits>
+    requires has_vertex_map<G> && has_nb_vertices<G> &&
+             std::integral<vertex_t<G>>
+class parallel_breadth_first_search {
+public:
+    using vertex = vertex_t<G>;
+    using arc = arc_t<G>;
+    using traits = T;
+
+    using reached_map = static_map<vertex, std::atomic<bool>>;
+    using pred_vertices_map =
+        std::conditional<traits::store_pred_vertices, vertex_map_t<G, vertex>,
+                         std::monostate>::type;
+    using pred_arcs_map =
+        std::conditional<traits::store_pred_arcs, vertex_map_t<G, arc>,
+                         std::monostate>::type;
+    using distances_map =
+        std::conditional<traits::store_distances, vertex_map_t<G, int>,
+                         std::monostate>::type;
+
+private:
+    static constexpr std::size_t chunk_size = 64;
+
+    std::reference_wrapper<const G> _graph;
+    parallel_policy _policy;
+
+    reached_map _reached_map;
+    std::vector<vertex> _frontier;
+    std::vector<std::vector<vertex>> _thread_next_frontiers;
+    std::atomic<std::size_t> _frontier_cursor;
+    int _level;
+
+    pred_vertices_map _pred_vertices_map;
+    pred_arcs_map _pred_arcs_map;
+    distances_map _dist_map;
+
+public:
+    [[nodiscard]] explicit parallel_breadth_first_search(
+        const G & g, const parallel_policy & policy = par)
+        : _graph(g)
+        , _policy(policy)
+        , _reached_map(static_cast<std::size_t>(melon::nb_vertices(g)), false)
+        , _frontier()
+        , _thread_next_frontiers(policy.thread_count())
+        , _frontier_cursor(0)
+        , _level(0)
+        , _pred_vertices_map(constexpr_ternary<traits::store_pred_vertices>(
+              create_vertex_map<vertex>(g), std::monostate{}))
+        , _pred_arcs_map(constexpr_ternary<traits::store_pred_arcs>(
+              create_vertex_map<arc>(g), std::monostate{}))
+        , _dist_map(constexpr_ternary<traits::store_distances>(
+              create_vertex_map<int>(g), std::monostate{})) {}
+
+    [[nodiscard]] parallel_breadth_first_search(
+        const G & g, const vertex & s, const parallel_policy & policy = par)
+        : parallel_breadth_first_search(g, policy) {
+        add_source(s);
+    }
+
+    parallel_breadth_first_search & reset() noexcept {
+        _reached_map.fill(false);
+        _frontier.resize(0);
+        _level = 0;
+        return *this;
+    }
+    parallel_breadth_first_search & add_source(const vertex & s) noexcept {
+        assert(!_reached_map[s]);
+        _reached_map[s] = true;
+        _frontier.push_back(s);
+        if constexpr(traits::store_pred_vertices) _pred_vertices_map[s] = s;
+        if constexpr(traits::store_distances) _dist_map[s] = 0;
+        return *this;
+    }
+
+private:
+    void process_frontier(std::vector<vertex> & next_frontier) noexcept {
+        const G & g = _graph.get();
+        for(;;) {
+            const std::size_t begin = _frontier_cursor.fetch_add(
+                chunk_size, std::memory_order_relaxed);
+            if(begin >= _frontier.size()) return;
+            const std::size_t end =
+                std::min(begin + chunk_size, _frontier.size());
+            for(std::size_t i = begin; i < end; ++i) {
+                const vertex u = _frontier[i];
+                for(auto && a : melon::out_arcs(g, u)) {
+                    const vertex w = melon::arc_target(g, a);
+                    if(_reached_map.test_and_set(w)) continue;
+                    next_frontier.push_back(w);
+                    if constexpr(traits::store_pred_vertices)
+                        _pred_vertices_map[w] = u;
+                    if constexpr(traits::store_pred_arcs)
+                        _pred_arcs_map[w] = a;
+                    if constexpr(traits::store_distances)
+                        _dist_map[w] = _level + 1;
+                }
+            }
+        }
+    }
+    // Concatenates the next frontiers, called by a single thread between
+    // levels.
+    void next_level() {
+        _frontier.resize(0);
+        for(auto && next_frontier : _thread_next_frontiers) {
+            _frontier.insert(_frontier.end(), next_frontier.begin(),
+                             next_frontier.end());
+            next_frontier.resize(0);
+        }
+        _frontier_cursor.store(0, std::memory_order_relaxed);
+        ++_level;
+    }
+
+public:
+    void run() {
+        if(_frontier.empty()) return;
+        _frontier_cursor.store(0, std::memory_order_relaxed);
+        const std::size_t nb_threads = _thread_next_frontiers.size();
+        std::barrier sync(static_cast<std::ptrdiff_t>(nb_threads),
+                          [this]() noexcept { next_level(); });
+        auto work = [&](const std::size_t t) {
+            while(!_frontier.empty()) {
+                process_frontier(_thread_next_frontiers[t]);
+                sync.arrive_and_wait();
+            }
+        };
+        std::vector<std::jthread> threads;
+        threads.reserve(nb_threads - 1);
+        for(std::size_t t = 1; t < nb_threads; ++t)
+            threads.emplace_back(work, t);
+        work(0);
+    }
+
+    [[nodiscard]] bool reached(const vertex & u) const noexcept {
+        return _reached_map[u];
+    }
+    [[nodiscard]] vertex pred_vertex(const vertex & u) const noexcept
+        requires(traits::store_pred_vertices)
+    {
+        assert(reached(u));
+        return _pred_vertices_map[u];
+    }
+    [[nodiscard]] arc pred_arc(const vertex & u) const noexcept
+        requires(traits::store_pred_arcs)
+    {
+        assert(reached(u));
+        return _pred_arcs_map[u];
+    }
+    [[nodiscard]] int dist(const vertex & u) const noexcept
+        requires(traits::store_distances)
+    {
+        assert(reached(u));
+        return _dist_map[u];
+    }
+};
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_ALGORITHM_PARALLEL_BFS_HPP
@@ -23,7 +23,8 @@ struct topological_sort_default_traits {
 };
 
 template <graph G, typename T = topological_sort_default_traits>
-    requires outward_incidence_graph<G> && has_vertex_map<G>
+    requires(outward_incidence_graph<G> || outward_adjacency_graph<G>) &&
+            has_vertex_map<G>
 class topological_sort {
 public:
     using vertex = vertex_t<G>;
@@ -61,7 +62,7 @@ private:
         _queue.resize(0);
         _queue_current = _queue.begin();
         _reached_map.fill(false);
-        if(has_in_degree<G>) {
+        if constexpr(has_in_degree<G>) {
             for(auto && u : vertices(_graph.get())) {
                 _remaining_in_degree_map[u] = in_degree(_graph.get(), u);
                 if(_remaining_in_degree_map[u] == 0) {
@@ -71,9 +72,14 @@ private:
         } else {
             _remaining_in_degree_map.fill(0);
             for(auto && u : vertices(_graph.get())) {
-                for(auto && a : out_arcs(_graph.get(), u)) {
-                    const vertex & w = arc_target(_graph.get(), a);
-                    ++_remaining_in_degree_map[w];
+                if constexpr(outward_incidence_graph<G>) {
+                    for(auto && a : out_arcs(_graph.get(), u)) {
+                        const vertex & w = arc_target(_graph.get(), a);
+                        ++_remaining_in_degree_map[w];
+                    }
+                } else {  // i.e., outward_adjacency_graph<G>
+                    for(auto && w : out_neighbors(_graph.get(), u))
+                        ++_remaining_in_degree_map[w];
                 }
             }
             for(auto && u : vertices(_graph.get())) {
@@ -130,14 +136,26 @@ public:
         assert(!finished());
         const vertex & u = *_queue_current;
         ++_queue_current;
-        for(auto && a : out_arcs(_graph.get(), u)) {
-            const vertex & w = arc_target(_graph.get(), a);
-            if(--_remaining_in_degree_map[w] > 0) continue;
-            _queue.push_back(w);
-            if constexpr(traits::store_pred_vertices) _pred_vertices_map[w] = u;
-            if constexpr(traits::store_pred_arcs) _pred_arcs_map[w] = a;
-            if constexpr(traits::store_distances)
-                _dist_map[w] = _dist_map[u] + 1;
+        if constexpr(outward_incidence_graph<G>) {
+            for(auto && a : out_arcs(_graph.get(), u)) {
+                const vertex & w = arc_target(_graph.get(), a);
+                if(--_remaining_in_degree_map[w] > 0) continue;
+                _queue.push_back(w);
+                if constexpr(traits::store_pred_vertices)
+                    _pred_vertices_map[w] = u;
+                if constexpr(traits::store_pred_arcs) _pred_arcs_map[w] = a;
+                if constexpr(traits::store_distances)
+                    _dist_map[w] = _dist_map[u] + 1;
+            }
+        } else {  // i.e., outward_adjacency_graph<G>
+            for(auto && w : out_neighbors(_graph.get(), u)) {
+                if(--_remaining_in_degree_map[w] > 0) continue;
+                _queue.push_back(w);
+                if constexpr(traits::store_pred_vertices)
+                    _pred_vertices_map[w] = u;
+                if constexpr(traits::store_distances)
+                    _dist_map[w] = _dist_map[u] + 1;
+            }
         }
     }
 
@@ -13,20 +13,43 @@
 
 #include "melon/container/mutable_digraph.hpp"
 #include "melon/container/static_digraph.hpp"
+#include "melon/container/mapped_static_digraph.hpp"
 #include "melon/utility/static_digraph_builder.hpp"
+#include "melon/utility/batch_query_executor.hpp"
+#include "melon/utility/graph_readers.hpp"
+#include "melon/utility/vertex_reordering.hpp"
 #include "melon/container/static_forward_digraph.hpp"
 #include "melon/container/static_forward_weighted_digraph.hpp"
+#include "melon/container/compressed_digraph.hpp"
+#include "melon/container/static_graph.hpp"
 
+#include "melon/algorithm/alt.hpp"
 #include "melon/algorithm/bidirectional_dijkstra.hpp"
 #include "melon/algorithm/breadth_first_search.hpp"
+#include "melon/algorithm/contraction_hierarchy.hpp"
 #include "melon/algorithm/depth_first_search.hpp"
+#include "melon/algorithm/delta_stepping.hpp"
+#include "melon/algorithm/direction_optimizing_bfs.hpp"
+#include "melon/algorithm/parallel_breadth_first_search.hpp"
+#include "melon/algorithm/multi_source_bfs.hpp"
 #include "melon/algorithm/dijkstra.hpp"
+#include "melon/algorithm/dinitz.hpp"
+#include "melon/algorithm/many_to_many.hpp"
 #include "melon/algorithm/strong_fiber.hpp"
 
 #include "melon/container/d_ary_heap.hpp"
+#include "melon/container/radix_heap.hpp"
+#include "melon/container/soa_d_ary_heap.hpp"
+#include "melon/container/plain_d_ary_heap.hpp"
+#include "melon/container/union_find.hpp"
+#include "melon/container/concurrent_union_find.hpp"
+#include "melon/container/dial_heap.hpp"
 #include "melon/container/static_map.hpp"
+#include "melon/container/growable_map.hpp"
+#include "melon/container/epoch_map.hpp"
+#include "melon/container/touched_map.hpp"
 
 #include "melon/utility/value_map.hpp"
-#include "melon/utility/semirings.hpp"
+#include "melon/utility/semiring.hpp"
 
 #endif  // FHAMONIC_MELON_HPP
\ No newline at end of file
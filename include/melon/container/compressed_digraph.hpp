@@ -0,0 +1,228 @@
+#ifndef MELON_COMPRESSED_DIGRAPH_HPP
+#define MELON_COMPRESSED_DIGRAPH_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <vector>
+
+#include "melon/container/static_map.hpp"
+#include "melon/detail/range_of.hpp"
+
+namespace fhamonic {
+namespace melon {
+namespace __detail {
+
+// LEB128 : 7 bits per byte, the high bit telling if another byte follows.
+inline void varint_encode(std::vector<std::uint8_t> & bytes, std::uint64_t x) {
+    while(x >= 0x80) {
+        bytes.push_back(static_cast<std::uint8_t>(x | 0x80));
+        x >>= 7;
+    }
+    bytes.push_back(static_cast<std::uint8_t>(x));
+}
+[[nodiscard]] inline std::uint64_t varint_decode(
+    const std::uint8_t *& p) noexcept {
+    std::uint64_t x = *p & 0x7f;
+    for(unsigned shift = 7; *p++ & 0x80; shift += 7)
+        x |= static_cast<std::uint64_t>(*p & 0x7f) << shift;
+    return x;
+}
+
+[[nodiscard]] inline std::uint64_t zigzag_encode(const std::int64_t x) noexcept {
+    return (static_cast<std::uint64_t>(x) << 1) ^
+           static_cast<std::uint64_t>(x >> 63);
+}
+[[nodiscard]] inline std::int64_t zigzag_decode(const std::uint64_t x) noexcept {
+    return static_cast<std::int64_t>((x >> 1) ^ (~(x & 1) + 1));
+}
+
+// Neighbors of u encoded as the zigzagged gap to u followed by the gaps
+// between consecutive neighbors, decoded while iterating.
+template <std::unsigned_integral V>
+class varint_neighbors_view : public std::ranges::view_base {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = V;
+        using difference_type = std::ptrdiff_t;
+
+    private:
+        const std::uint8_t * _current;
+        const std::uint8_t * _next;
+        const std::uint8_t * _end;
+        V _value;
+
+    public:
+        [[nodiscard]] iterator() noexcept
+            : _current(nullptr), _next(nullptr), _end(nullptr), _value() {}
+        [[nodiscard]] iterator(const std::uint8_t * begin,
+                               const std::uint8_t * end, const V u) noexcept
+            : _current(begin), _next(begin), _end(end), _value(u) {
+            if(_current == _end) return;
+            _value = static_cast<V>(static_cast<std::int64_t>(u) +
+                                    zigzag_decode(varint_decode(_next)));
+        }
+
+        [[nodiscard]] V operator*() const noexcept { return _value; }
+        iterator & operator++() noexcept {
+            _current = _next;
+            if(_current != _end) _value += static_cast<V>(varint_decode(_next));
+            return *this;
+        }
+        iterator operator++(int) noexcept {
+            iterator it = *this;
+            ++*this;
+            return it;
+        }
+
+        [[nodiscard]] friend bool operator==(const iterator & a,
+                                             const iterator & b) noexcept {
+            return a._current == b._current;
+        }
+        [[nodiscard]] friend bool operator==(const iterator & it,
+                                             std::default_sentinel_t) noexcept {
+            return it._current == it._end;
+        }
+    };
+
+private:
+    const std::uint8_t * _begin;
+    const std::uint8_t * _end;
+    V _source;
+
+public:
+    [[nodiscard]] varint_neighbors_view() noexcept
+        : _begin(nullptr), _end(nullptr), _source() {}
+    [[nodiscard]] varint_neighbors_view(const std::uint8_t * begin,
+                                        const std::uint8_t * end,
+                                        const V u) noexcept
+        : _begin(begin), _end(end), _source(u) {}
+
+    [[nodiscard]] iterator begin() const noexcept {
+        return iterator(_begin, _end, _source);
+    }
+    [[nodiscard]] std::default_sentinel_t end() const noexcept {
+        return std::default_sentinel;
+    }
+    [[nodiscard]] bool empty() const noexcept { return _begin == _end; }
+};
+
+}  // namespace __detail
+
+// Read-only digraph storing the sorted out neighbors of each vertex as gap
+// encoded varints, decoded on the fly by out_neighbors. Arcs have no
+// addressable endpoints, thus it is an outward_adjacency_graph only.
+template <std::unsigned_integral V = unsigned int,
+          std::unsigned_integral O = std::size_t>
+class basic_compressed_digraph {
+private:
+    using vertex = V;
+    using arc = O;
+    using offset = O;
+
+    static_map<vertex, offset> _out_neighbors_begin;
+    std::vector<std::uint8_t> _out_neighbors_bytes;
+    std::size_t _nb_arcs;
+
+    void encode_neighbors(const vertex u, std::vector<vertex> & neighbors) {
+        std::ranges::sort(neighbors);
+        if(!neighbors.empty())
+            __detail::varint_encode(
+                _out_neighbors_bytes,
+                __detail::zigzag_encode(static_cast<std::int64_t>(neighbors[0]) -
+                                        static_cast<std::int64_t>(u)));
+        for(std::size_t i = 1; i < neighbors.size(); ++i)
+            __detail::varint_encode(_out_neighbors_bytes,
+                                    neighbors[i] - neighbors[i - 1]);
+        neighbors.resize(0);
+        _out_neighbors_begin[u + 1] =
+            static_cast<offset>(_out_neighbors_bytes.size());
+    }
+
+public:
+    // Arcs must be sorted by source. The out neighbors of each vertex are
+    // sorted before being encoded, so the arc order is not preserved.
+    template <forward_range_of<vertex> S, forward_range_of<vertex> T>
+    basic_compressed_digraph(const std::size_t & nb_vertices, S && sources,
+                             T && targets)
+        : _out_neighbors_begin(nb_vertices + 1, 0), _nb_arcs(0) {
+        assert(std::ranges::all_of(
+            sources, [n = nb_vertices](auto && v) { return v < n; }));
+        assert(std::ranges::all_of(
+            targets, [n = nb_vertices](auto && v) { return v < n; }));
+        assert(std::ranges::is_sorted(sources));
+        std::vector<vertex> neighbors;
+        vertex u = 0;
+        auto target_it = std::ranges::begin(targets);
+        for(auto && s : sources) {
+            for(; u < s; ++u) encode_neighbors(u, neighbors);
+            neighbors.push_back(*target_it);
+            ++target_it;
+            ++_nb_arcs;
+        }
+        for(; u < nb_vertices; ++u) encode_neighbors(u, neighbors);
+        _out_neighbors_bytes.shrink_to_fit();
+    }
+
+    basic_compressed_digraph() : _out_neighbors_begin(1, 0), _nb_arcs(0) {}
+    basic_compressed_digraph(const basic_compressed_digraph & graph) = default;
+    basic_compressed_digraph(basic_compressed_digraph && graph) = default;
+
+    basic_compressed_digraph & operator=(const basic_compressed_digraph &) =
+        default;
+    basic_compressed_digraph & operator=(basic_compressed_digraph &&) = default;
+
+    auto nb_vertices() const noexcept {
+        return _out_neighbors_begin.size() - 1;
+    }
+    auto nb_arcs() const noexcept { return _nb_arcs; }
+    auto nb_encoded_bytes() const noexcept {
+        return _out_neighbors_bytes.size();
+    }
+
+    bool is_valid_vertex(const vertex & u) const noexcept {
+        return u < nb_vertices();
+    }
+
+    auto vertices() const noexcept {
+        return std::views::iota(static_cast<vertex>(0),
+                                static_cast<vertex>(nb_vertices()));
+    }
+    auto arcs() const noexcept {
+        return std::views::iota(static_cast<arc>(0),
+                                static_cast<arc>(nb_arcs()));
+    }
+    auto out_neighbors(const vertex & u) const noexcept {
+        assert(is_valid_vertex(u));
+        return __detail::varint_neighbors_view<vertex>(
+            _out_neighbors_bytes.data() + _out_neighbors_begin[u],
+            _out_neighbors_bytes.data() + _out_neighbors_begin[u + 1], u);
+    }
+
+    template <typename T>
+    static_map<vertex, T> create_vertex_map() const noexcept {
+        return static_map<vertex, T>(nb_vertices());
+    }
+    template <typename T>
+    static_map<vertex, T> create_vertex_map(
+        const T & default_value) const noexcept {
+        return static_map<vertex, T>(nb_vertices(), default_value);
+    }
+};
+
+using compressed_digraph = basic_compressed_digraph<>;
+
+}  // namespace melon
+}  // namespace fhamonic
+
+template <typename V>
+inline constexpr bool std::ranges::enable_borrowed_range<
+    fhamonic::melon::__detail::varint_neighbors_view<V>> = true;
+
+#endif  // MELON_COMPRESSED_DIGRAPH_HPP
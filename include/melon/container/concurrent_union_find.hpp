@@ -0,0 +1,91 @@
+#ifndef MELON_CONCURRENT_UNION_FIND_HPP
+#define MELON_CONCURRENT_UNION_FIND_HPP
+
+#include <atomic>
+#include <cassert>
+#include <concepts>
+#include <memory>
+#include <utility>
+
+namespace fhamonic {
+namespace melon {
+
+// Disjoint sets over the keys 0 to size()-1 on which find, connected and
+// join can be called by several threads at once. Each parent is an atomic
+// and join links the root of larger key under the root of smaller key with
+// a compare and swap, retrying if one of the roots was linked meanwhile.
+// Linking by key keeps the parent links decreasing, so that no cycle can
+// appear, and makes the root of a set its smallest key. find halves the
+// paths with compare and swaps that may fail harmlessly.
+template <std::unsigned_integral K = unsigned int>
+class concurrent_union_find {
+public:
+    using key_type = K;
+    using component_type = K;
+    using size_type = std::size_t;
+
+private:
+    std::unique_ptr<std::atomic<key_type>[]> _parents;
+    size_type _size;
+
+public:
+    [[nodiscard]] concurrent_union_find() noexcept : _parents(), _size(0) {}
+    [[nodiscard]] explicit concurrent_union_find(const size_type & nb_keys)
+        : _parents(std::make_unique<std::atomic<key_type>[]>(nb_keys))
+        , _size(nb_keys) {
+        for(size_type k = 0; k < nb_keys; ++k)
+            _parents[k].store(static_cast<key_type>(k),
+                              std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] concurrent_union_find(concurrent_union_find && bin) =
+        default;
+    concurrent_union_find & operator=(concurrent_union_find &&) = default;
+
+    [[nodiscard]] size_type size() const noexcept { return _size; }
+    [[nodiscard]] bool empty() const noexcept { return _size == 0; }
+
+    [[nodiscard]] component_type find(key_type k) noexcept {
+        assert(k < size());
+        for(;;) {
+            key_type parent = _parents[k].load(std::memory_order_acquire);
+            if(parent == k) return k;
+            const key_type grand_parent =
+                _parents[parent].load(std::memory_order_acquire);
+            if(grand_parent != parent)
+                _parents[k].compare_exchange_weak(parent, grand_parent,
+                                                  std::memory_order_acq_rel,
+                                                  std::memory_order_relaxed);
+            k = grand_parent;
+        }
+    }
+    [[nodiscard]] bool connected(key_type k1, key_type k2) noexcept {
+        for(;;) {
+            k1 = find(k1);
+            k2 = find(k2);
+            if(k1 == k2) return true;
+            // k1 may have been linked after being found
+            if(_parents[k1].load(std::memory_order_acquire) == k1)
+                return false;
+        }
+    }
+    // Merges the sets of k1 and k2, returns false if they were the same.
+    bool join(key_type k1, key_type k2) noexcept {
+        for(;;) {
+            k1 = find(k1);
+            k2 = find(k2);
+            if(k1 == k2) return false;
+            if(k1 < k2) std::swap(k1, k2);
+            key_type expected = k1;
+            if(_parents[k1].compare_exchange_strong(expected, k2,
+                                                    std::memory_order_acq_rel,
+                                                    std::memory_order_relaxed))
+                return true;
+        }
+    }
+};  // class concurrent_union_find
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_CONCURRENT_UNION_FIND_HPP
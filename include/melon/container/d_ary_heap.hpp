@@ -3,11 +3,13 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <functional>
-#include <unordered_map>
+#include <limits>
 #include <utility>
 #include <vector>
 
+#include "melon/container/growable_map.hpp"
 #include "melon/utility/value_map.hpp"
 
 namespace fhamonic {
@@ -18,7 +20,8 @@ template <int D, typename K, typename P,
               [](const std::pair<K, P> & e1, const std::pair<K, P> & e2) {
                   return e1.second > e2.second;
               }),
-          output_value_map<K> M = std::unordered_map<K, std::size_t>>
+          output_value_map<K> M =
+              __detail::default_indices_map_t<K, std::uint32_t>>
 requires std::integral<mapped_value_t<M, K>>
 class d_ary_heap {
 public:
@@ -29,6 +32,8 @@ public:
 private:
     using size_type = std::size_t;
     using indice_map = M;
+    // the indices map holds positions in the heap array, not byte offsets
+    using index_type = mapped_value_t<M, K>;
 
 public:
     std::vector<entry> _heap_array;
@@ -146,7 +151,8 @@ private:
     constexpr void heap_move(const size_type i, entry && p) noexcept {
         assert(0 <= (i / sizeof(entry)) &&
                (i / sizeof(entry)) < _heap_array.size());
-        _indices_map[p.first] = i;
+        assert(i / sizeof(entry) <= std::numeric_limits<index_type>::max());
+        _indices_map[p.first] = static_cast<index_type>(i / sizeof(entry));
         entry_ref(i) = std::move(p);
     }
     // EXPECTED_CPP23 goto in constexpr functions
@@ -190,12 +196,16 @@ private:
     ok:
         heap_move(hole_index, std::move(p));
     }
-    [[nodiscard]] constexpr size_type index_of(
+    [[nodiscard]] constexpr size_type position_of(
         const key_type & k) const noexcept {
         if constexpr(requires() { std::as_const(_indices_map)[k]; })
-            return _indices_map[k];
+            return static_cast<size_type>(_indices_map[k]);
         else
-            return _indices_map.at(k);
+            return static_cast<size_type>(_indices_map.at(k));
+    }
+    [[nodiscard]] constexpr size_type index_of(
+        const key_type & k) const noexcept {
+        return position_of(k) * sizeof(entry);
     }
     constexpr void push(entry && p) noexcept {
         const size_type n = _heap_array.size();
@@ -212,7 +222,7 @@ public:
         return entry_ref(index_of(k)).second;
     }
     [[nodiscard]] constexpr bool contains(const key_type & k) const noexcept {
-        const size_type i = index_of(k);
+        const size_type i = position_of(k);
         if(i >= _heap_array.size()) return false;
         return _heap_array[i].first == k;
     }
@@ -230,12 +240,13 @@ public:
     }
     constexpr void promote(const key_type & k,
                            const priority_type & p) noexcept {
-        assert(_cmp(entry(k, p), entry_ref(_indices_map[k])));
-        heap_push(_indices_map[k], entry(k, p));
+        assert(_cmp(entry(k, p), entry_ref(index_of(k))));
+        heap_push(index_of(k), entry(k, p));
     }
     void demote(const key_type & k, const priority_type & p) noexcept {
-        assert(_cmp(entry_ref(_indices_map[k]), entry(k, p)));
-        adjust_heap(_indices_map[k], entry(k, p));
+        assert(_cmp(entry_ref(index_of(k)), entry(k, p)));
+        adjust_heap(index_of(k), _heap_array.size() * sizeof(entry),
+                    entry(k, p));
     }
 };  // class d_ary_heap
 
@@ -244,7 +255,7 @@ template <typename K, typename P,
               [](const std::pair<K, P> & e1, const std::pair<K, P> & e2) {
                   return e1.second > e2.second;
               }),
-          typename M = std::unordered_map<K, std::size_t>>
+          typename M = __detail::default_indices_map_t<K, std::uint32_t>>
 using binary_heap = d_ary_heap<2, K, P, C, M>;
 
 }  // namespace melon
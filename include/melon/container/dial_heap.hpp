@@ -0,0 +1,183 @@
+#ifndef MELON_DIAL_HEAP_HPP
+#define MELON_DIAL_HEAP_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <utility>
+#include <vector>
+
+#include "melon/container/growable_map.hpp"
+#include "melon/utility/value_map.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Monotone min priority queue on non-negative integer priorities : pushed and
+// promoted priorities must not be smaller than the last popped one. Entries
+// of priority p lie in the bucket p mod B of a circular array of B buckets,
+// B being a power of two greater than the spread of the priorities in the
+// queue, e.g. the maximum arc length plus one for Dijkstra. The array grows
+// when a push exceeds this spread, so B never needs to be given.
+template <typename K, std::integral P,
+          output_value_map<K> M =
+              __detail::default_indices_map_t<K, std::size_t>>
+requires std::integral<mapped_value_t<M, K>>
+class dial_heap {
+public:
+    using key_type = K;
+    using priority_type = P;
+    using entry = std::pair<key_type, priority_type>;
+
+private:
+    using size_type = std::size_t;
+    using indice_map = M;
+
+    std::vector<std::vector<entry>> _buckets;
+    // (index in bucket << _log_nb_buckets) | bucket
+    indice_map _indices_map;
+    size_type _log_nb_buckets;
+    // _current is the minimum priority in the queue and _max an upper bound
+    // on its priorities, reset when the queue gets empty
+    priority_type _current;
+    priority_type _max;
+    size_type _size;
+
+public:
+    [[nodiscard]] constexpr dial_heap()
+        : _buckets(1)
+        , _indices_map()
+        , _log_nb_buckets(0)
+        , _current(0)
+        , _max(0)
+        , _size(0) {}
+
+    template <typename IMA>
+    [[nodiscard]] constexpr explicit dial_heap(IMA && indice_map_arg)
+        : _buckets(1)
+        , _indices_map(std::forward<IMA>(indice_map_arg))
+        , _log_nb_buckets(0)
+        , _current(0)
+        , _max(0)
+        , _size(0) {}
+
+    [[nodiscard]] constexpr dial_heap(const dial_heap & bin) = default;
+    [[nodiscard]] constexpr dial_heap(dial_heap && bin) = default;
+
+    dial_heap & operator=(const dial_heap &) = default;
+    dial_heap & operator=(dial_heap &&) = default;
+
+    [[nodiscard]] constexpr size_type size() const noexcept { return _size; }
+    [[nodiscard]] constexpr bool empty() const noexcept { return _size == 0; }
+    constexpr void clear() noexcept {
+        for(auto && bucket : _buckets) bucket.resize(0);
+        _size = 0;
+    }
+
+private:
+    [[nodiscard]] constexpr size_type nb_buckets() const noexcept {
+        return _buckets.size();
+    }
+    [[nodiscard]] constexpr size_type bucket_mask() const noexcept {
+        return nb_buckets() - 1;
+    }
+    [[nodiscard]] constexpr size_type bucket_of(
+        const priority_type & p) const noexcept {
+        return static_cast<size_type>(p) & bucket_mask();
+    }
+    constexpr void bucket_push(entry && e) noexcept {
+        const size_type b = bucket_of(e.second);
+        _indices_map[e.first] = (_buckets[b].size() << _log_nb_buckets) | b;
+        _buckets[b].push_back(std::move(e));
+    }
+    constexpr entry bucket_erase(const size_type index) noexcept {
+        std::vector<entry> & bucket = _buckets[index & bucket_mask()];
+        const size_type i = index >> _log_nb_buckets;
+        entry e = std::move(bucket[i]);
+        if(i + 1 < bucket.size()) {
+            bucket[i] = std::move(bucket.back());
+            _indices_map[bucket[i].first] = index;
+        }
+        bucket.pop_back();
+        return e;
+    }
+    // Ensures that the priorities in [lo, hi] map to distinct buckets.
+    void reserve_spread(const priority_type & lo, const priority_type & hi) {
+        const size_type spread = static_cast<size_type>(hi - lo) + 1;
+        if(spread <= nb_buckets()) return;
+        std::vector<std::vector<entry>> old_buckets(std::bit_ceil(spread));
+        old_buckets.swap(_buckets);
+        _log_nb_buckets =
+            static_cast<size_type>(std::countr_zero(_buckets.size()));
+        for(auto && bucket : old_buckets)
+            for(auto && e : bucket) bucket_push(std::move(e));
+    }
+    // Moves _current to the minimum priority if the queue is not empty.
+    constexpr void advance_current() noexcept {
+        if(_size == 0) return;
+        while(_buckets[bucket_of(_current)].empty()) ++_current;
+    }
+    [[nodiscard]] constexpr size_type index_of(
+        const key_type & k) const noexcept {
+        if constexpr(requires() { std::as_const(_indices_map)[k]; })
+            return static_cast<size_type>(_indices_map[k]);
+        else
+            return static_cast<size_type>(_indices_map.at(k));
+    }
+    [[nodiscard]] constexpr const entry & entry_ref(
+        const size_type index) const noexcept {
+        return _buckets[index & bucket_mask()][index >> _log_nb_buckets];
+    }
+
+public:
+    void push(const key_type & k, const priority_type & p) noexcept {
+        if(_size == 0) {
+            _current = _max = p;
+        } else {
+            reserve_spread(std::min(_current, p), std::max(_max, p));
+            _current = std::min(_current, p);
+            _max = std::max(_max, p);
+        }
+        bucket_push(entry(k, p));
+        ++_size;
+    }
+    [[nodiscard]] constexpr priority_type priority(
+        const key_type & k) const noexcept {
+        return entry_ref(index_of(k)).second;
+    }
+    [[nodiscard]] constexpr bool contains(const key_type & k) const noexcept {
+        if constexpr(requires() { _indices_map.find(k); })
+            if(_indices_map.find(k) == _indices_map.end()) return false;
+        const size_type index = index_of(k);
+        if((index >> _log_nb_buckets) >= _buckets[index & bucket_mask()].size())
+            return false;
+        return entry_ref(index).first == k;
+    }
+    [[nodiscard]] constexpr entry top() const noexcept {
+        assert(!empty());
+        return _buckets[bucket_of(_current)].back();
+    }
+    constexpr void pop() noexcept {
+        assert(!empty());
+        _buckets[bucket_of(_current)].pop_back();
+        --_size;
+        advance_current();
+    }
+    constexpr void promote(const key_type & k,
+                           const priority_type & p) noexcept {
+        assert(p < priority(k));
+        entry e = bucket_erase(_indices_map[k]);
+        if(p < _current) {
+            reserve_spread(p, _max);
+            _current = p;
+        }
+        e.second = p;
+        bucket_push(std::move(e));
+    }
+};  // class dial_heap
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_DIAL_HEAP_HPP
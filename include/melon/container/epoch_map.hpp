@@ -0,0 +1,74 @@
+#ifndef MELON_EPOCH_MAP_HPP
+#define MELON_EPOCH_MAP_HPP
+
+#include <cassert>
+#include <concepts>
+
+#include "melon/container/static_map.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Map whose fill() is O(1) : each value is stamped with the epoch of its last
+// write and values stamped with a past epoch read as the fill value. fill()
+// only starts a new epoch, the stamps being cleared when the epoch counter
+// wraps around. Non const lookups refresh the stamp of the key.
+template <std::integral K, typename V, std::unsigned_integral E = unsigned int>
+class epoch_map {
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using size_type = std::size_t;
+
+private:
+    struct entry {
+        E epoch;
+        V value;
+    };
+
+    static_map<K, entry> _entries;
+    E _epoch;
+    V _fill_value;
+
+public:
+    [[nodiscard]] constexpr epoch_map() : _entries(), _epoch(1), _fill_value() {}
+    [[nodiscard]] constexpr explicit epoch_map(const size_type size,
+                                               const V & fill_value = V())
+        : _entries(size, entry{0, fill_value})
+        , _epoch(1)
+        , _fill_value(fill_value) {}
+
+    [[nodiscard]] constexpr epoch_map(const epoch_map &) = default;
+    [[nodiscard]] constexpr epoch_map(epoch_map &&) = default;
+    epoch_map & operator=(const epoch_map &) = default;
+    epoch_map & operator=(epoch_map &&) = default;
+
+    [[nodiscard]] constexpr size_type size() const noexcept {
+        return _entries.size();
+    }
+
+    [[nodiscard]] constexpr V & operator[](const K k) noexcept {
+        entry & e = _entries[k];
+        if(e.epoch != _epoch) {
+            e.epoch = _epoch;
+            e.value = _fill_value;
+        }
+        return e.value;
+    }
+    [[nodiscard]] constexpr const V & operator[](const K k) const noexcept {
+        const entry & e = _entries[k];
+        return e.epoch == _epoch ? e.value : _fill_value;
+    }
+
+    constexpr void fill(const V & v) noexcept {
+        _fill_value = v;
+        if(++_epoch != 0) return;
+        _entries.fill(entry{0, v});
+        _epoch = 1;
+    }
+};
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_EPOCH_MAP_HPP
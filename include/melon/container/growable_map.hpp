@@ -0,0 +1,73 @@
+#ifndef MELON_GROWABLE_MAP_HPP
+#define MELON_GROWABLE_MAP_HPP
+
+#include <algorithm>
+#include <concepts>
+#include <unordered_map>
+#include <vector>
+
+namespace fhamonic {
+namespace melon {
+
+// Map on non-negative integer keys stored in a vector that grows to the
+// largest key written. Reading a key that was never written gives V().
+// It is the default indices map of the heaps, which are often used without
+// knowing the range of the keys beforehand.
+template <typename K, typename V>
+requires std::integral<K>
+class growable_map {
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using size_type = std::size_t;
+
+private:
+    std::vector<mapped_type> _values;
+
+public:
+    [[nodiscard]] constexpr growable_map() = default;
+    [[nodiscard]] constexpr explicit growable_map(const size_type size)
+        : _values(size) {}
+
+    [[nodiscard]] constexpr growable_map(const growable_map &) = default;
+    [[nodiscard]] constexpr growable_map(growable_map &&) = default;
+    growable_map & operator=(const growable_map &) = default;
+    growable_map & operator=(growable_map &&) = default;
+
+    [[nodiscard]] constexpr size_type size() const noexcept {
+        return _values.size();
+    }
+
+    [[nodiscard]] constexpr mapped_type & operator[](const key_type & k) {
+        const auto i = static_cast<size_type>(k);
+        if(i >= _values.size()) _values.resize(i + 1);
+        return _values[i];
+    }
+    [[nodiscard]] constexpr mapped_type operator[](
+        const key_type & k) const noexcept {
+        const auto i = static_cast<size_type>(k);
+        return i < _values.size() ? _values[i] : mapped_type();
+    }
+
+    void fill(const mapped_type & v) noexcept { std::ranges::fill(_values, v); }
+};
+
+namespace __detail {
+
+// growable_map for integer keys, std::unordered_map otherwise
+template <typename K, typename V>
+struct default_indices_map {
+    using type = std::unordered_map<K, V>;
+};
+template <std::integral K, typename V>
+struct default_indices_map<K, V> {
+    using type = growable_map<K, V>;
+};
+template <typename K, typename V>
+using default_indices_map_t = typename default_indices_map<K, V>::type;
+
+}  // namespace __detail
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_GROWABLE_MAP_HPP
@@ -0,0 +1,429 @@
+#ifndef MELON_MAPPED_STATIC_DIGRAPH_HPP
+#define MELON_MAPPED_STATIC_DIGRAPH_HPP
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "melon/container/static_digraph.hpp"
+#include "melon/container/static_map.hpp"
+#include "melon/detail/mapped_file.hpp"
+#include "melon/graph.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// On-disk layout of a static_digraph, version 1 :
+//   file_header
+//   section_entry[5 + nb_vertex_maps + nb_arc_maps]
+//   sections, each starting at a multiple of section_alignment
+// The five first sections hold the CSR arrays of the graph in the order
+// out_arc_begin, arc_target, arc_source, in_arc_begin, in_arcs, followed by
+// the vertex maps and then the arc maps. Integers are stored in the native
+// byte order, which is checked through the endianness tag.
+namespace __detail {
+struct static_digraph_file_header {
+    static constexpr std::array<char, 8> expected_magic = {'M', 'E', 'L', 'O',
+                                                           'N', 'S', 'D', 'G'};
+    static constexpr std::uint32_t current_version = 1;
+    static constexpr std::uint32_t endianness_tag = 0x01020304;
+
+    std::array<char, 8> magic;
+    std::uint32_t version;
+    std::uint32_t endianness;
+    std::uint32_t vertex_size;
+    std::uint32_t arc_size;
+    std::uint64_t nb_vertices;
+    std::uint64_t nb_arcs;
+    std::uint32_t nb_vertex_maps;
+    std::uint32_t nb_arc_maps;
+};
+
+struct static_digraph_file_section {
+    std::uint64_t offset;
+    std::uint64_t nb_values;
+    std::uint64_t value_size;
+};
+
+inline constexpr std::size_t static_digraph_file_nb_graph_sections = 5;
+inline constexpr std::size_t static_digraph_file_section_alignment = 64;
+}  // namespace __detail
+
+template <std::unsigned_integral V = unsigned int,
+          std::unsigned_integral A = unsigned int>
+class mapped_static_digraph_writer {
+private:
+    using vertex = V;
+    using arc = A;
+    using graph_type = basic_static_digraph<vertex, arc>;
+    using header = __detail::static_digraph_file_header;
+    using section = __detail::static_digraph_file_section;
+
+    struct payload {
+        const std::byte * data;
+        std::size_t nb_values;
+        std::size_t value_size;
+    };
+
+    std::reference_wrapper<const graph_type> _graph;
+    std::vector<payload> _vertex_maps;
+    std::vector<payload> _arc_maps;
+
+    template <typename M>
+    static payload make_payload(const M & map) noexcept {
+        using value_t = std::remove_cvref_t<decltype(*map.data())>;
+        static_assert(std::is_trivially_copyable_v<value_t>,
+                      "mapped values must be trivially copyable.");
+        return payload{reinterpret_cast<const std::byte *>(map.data()),
+                       static_cast<std::size_t>(map.size()), sizeof(value_t)};
+    }
+
+    static std::uint64_t aligned(const std::uint64_t offset) noexcept {
+        constexpr std::uint64_t alignment =
+            __detail::static_digraph_file_section_alignment;
+        return (offset + alignment - 1) / alignment * alignment;
+    }
+
+public:
+    [[nodiscard]] explicit mapped_static_digraph_writer(
+        const graph_type & g) noexcept
+        : _graph(g) {}
+
+    template <typename M>
+        requires requires(const M & m) {
+                     { m.data() } -> std::convertible_to<const void *>;
+                     { m.size() } -> std::integral;
+                 }
+    mapped_static_digraph_writer & add_vertex_map(const M & map) {
+        if(static_cast<std::size_t>(map.size()) != _graph.get().nb_vertices())
+            throw std::invalid_argument(
+                "vertex map size differs from the number of vertices.");
+        _vertex_maps.push_back(make_payload(map));
+        return *this;
+    }
+
+    template <typename M>
+        requires requires(const M & m) {
+                     { m.data() } -> std::convertible_to<const void *>;
+                     { m.size() } -> std::integral;
+                 }
+    mapped_static_digraph_writer & add_arc_map(const M & map) {
+        if(static_cast<std::size_t>(map.size()) != _graph.get().nb_arcs())
+            throw std::invalid_argument(
+                "arc map size differs from the number of arcs.");
+        _arc_maps.push_back(make_payload(map));
+        return *this;
+    }
+
+    void write(const std::filesystem::path & path) const {
+        const graph_type & g = _graph.get();
+        const std::size_t n = g.nb_vertices();
+        const std::size_t m = g.nb_arcs();
+
+        std::vector<arc> out_arc_begin(n);
+        std::vector<arc> in_arc_begin(n);
+        std::vector<arc> in_arcs(m);
+        auto in_arcs_it = in_arcs.begin();
+        for(auto && u : g.vertices()) {
+            out_arc_begin[u] = *g.out_arcs(u).begin();
+            in_arc_begin[u] =
+                static_cast<arc>(std::distance(in_arcs.begin(), in_arcs_it));
+            in_arcs_it = std::ranges::copy(g.in_arcs(u), in_arcs_it).out;
+        }
+        std::vector<vertex> arc_target(m);
+        std::vector<vertex> arc_source(m);
+        for(auto && a : g.arcs()) {
+            arc_target[a] = g.arc_target(a);
+            arc_source[a] = g.arc_source(a);
+        }
+
+        std::vector<payload> payloads{
+            make_payload(out_arc_begin), make_payload(arc_target),
+            make_payload(arc_source), make_payload(in_arc_begin),
+            make_payload(in_arcs)};
+        payloads.insert(payloads.end(), _vertex_maps.begin(),
+                        _vertex_maps.end());
+        payloads.insert(payloads.end(), _arc_maps.begin(), _arc_maps.end());
+
+        header h{header::expected_magic,
+                 header::current_version,
+                 header::endianness_tag,
+                 sizeof(vertex),
+                 sizeof(arc),
+                 n,
+                 m,
+                 static_cast<std::uint32_t>(_vertex_maps.size()),
+                 static_cast<std::uint32_t>(_arc_maps.size())};
+        std::vector<section> sections;
+        std::uint64_t offset =
+            aligned(sizeof(header) + payloads.size() * sizeof(section));
+        for(auto && p : payloads) {
+            sections.push_back(section{offset, p.nb_values, p.value_size});
+            offset = aligned(offset + p.nb_values * p.value_size);
+        }
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if(!file)
+            throw std::runtime_error("Cannot open '" + path.string() +
+                                     "' for writing.");
+        file.write(reinterpret_cast<const char *>(&h), sizeof(header));
+        file.write(reinterpret_cast<const char *>(sections.data()),
+                   static_cast<std::streamsize>(sections.size() *
+                                                sizeof(section)));
+        for(std::size_t i = 0; i < payloads.size(); ++i) {
+            const std::uint64_t padding =
+                sections[i].offset - static_cast<std::uint64_t>(file.tellp());
+            for(std::uint64_t j = 0; j < padding; ++j) file.put('\0');
+            file.write(reinterpret_cast<const char *>(payloads[i].data),
+                       static_cast<std::streamsize>(payloads[i].nb_values *
+                                                    payloads[i].value_size));
+        }
+        if(!file)
+            throw std::runtime_error("Cannot write '" + path.string() + "'.");
+    }
+};
+
+// Read-only static_digraph whose arrays are read directly from a file
+// written by mapped_static_digraph_writer. Opening the file costs O(1) and the
+// pages are shared with every other process mapping it. Opening only checks
+// the header and the section bounds; validate() checks the arrays of a file
+// that may not come from the writer.
+template <std::unsigned_integral V = unsigned int,
+          std::unsigned_integral A = unsigned int>
+class basic_mapped_static_digraph {
+private:
+    using vertex = V;
+    using arc = A;
+    using header = __detail::static_digraph_file_header;
+    using section = __detail::static_digraph_file_section;
+
+    __detail::mapped_file _file;
+    std::span<const section> _sections;
+    std::size_t _nb_vertex_maps;
+    std::size_t _nb_arc_maps;
+
+    std::span<const arc> _out_arc_begin;
+    std::span<const vertex> _arc_target;
+    std::span<const vertex> _arc_source;
+    std::span<const arc> _in_arc_begin;
+    std::span<const arc> _in_arcs;
+
+    template <typename T>
+    std::span<const T> section_span(const std::size_t i) const {
+        const section & s = _sections[i];
+        if(s.value_size != sizeof(T))
+            throw std::runtime_error("Mapped values size mismatch.");
+        return std::span<const T>(
+            reinterpret_cast<const T *>(_file.data() + s.offset),
+            static_cast<std::size_t>(s.nb_values));
+    }
+
+    // Checks the header and that the sections lie in the file, in O(1) per
+    // section : the arrays themselves are not read, see validate().
+    void check_file() {
+        const std::size_t file_size = _file.size();
+        if(file_size < sizeof(header))
+            throw std::runtime_error("File too small to be a static_digraph.");
+        header h;
+        std::memcpy(&h, _file.data(), sizeof(header));
+        if(h.magic != header::expected_magic)
+            throw std::runtime_error("Not a static_digraph file.");
+        if(h.version != header::current_version)
+            throw std::runtime_error("Unsupported static_digraph file version.");
+        if(h.endianness != header::endianness_tag)
+            throw std::runtime_error("static_digraph file endianness mismatch.");
+        if(h.vertex_size != sizeof(vertex) || h.arc_size != sizeof(arc))
+            throw std::runtime_error("static_digraph file index width mismatch.");
+        if(h.nb_vertices > std::numeric_limits<vertex>::max() ||
+           h.nb_arcs > std::numeric_limits<arc>::max())
+            throw std::runtime_error("Corrupted static_digraph file.");
+        _nb_vertex_maps = h.nb_vertex_maps;
+        _nb_arc_maps = h.nb_arc_maps;
+        const std::size_t nb_sections =
+            __detail::static_digraph_file_nb_graph_sections + _nb_vertex_maps +
+            _nb_arc_maps;
+        if(nb_sections > (file_size - sizeof(header)) / sizeof(section))
+            throw std::runtime_error("Truncated static_digraph file.");
+        _sections = std::span<const section>(
+            reinterpret_cast<const section *>(_file.data() + sizeof(header)),
+            nb_sections);
+        for(std::size_t i = 0; i < nb_sections; ++i) {
+            const section & s = _sections[i];
+            if(s.offset % __detail::static_digraph_file_section_alignment != 0 ||
+               s.offset > file_size || s.value_size == 0 ||
+               s.nb_values > (file_size - s.offset) / s.value_size)
+                throw std::runtime_error("Corrupted static_digraph file.");
+            const bool is_vertex_section =
+                i == 0 || i == 3 ||
+                (i >= __detail::static_digraph_file_nb_graph_sections &&
+                 i < __detail::static_digraph_file_nb_graph_sections +
+                         _nb_vertex_maps);
+            if(s.nb_values != (is_vertex_section ? h.nb_vertices : h.nb_arcs))
+                throw std::runtime_error("Corrupted static_digraph file.");
+        }
+    }
+
+public:
+    [[nodiscard]] explicit basic_mapped_static_digraph(
+        const std::filesystem::path & path)
+        : _file(path) {
+        check_file();
+        _out_arc_begin = section_span<arc>(0);
+        _arc_target = section_span<vertex>(1);
+        _arc_source = section_span<vertex>(2);
+        _in_arc_begin = section_span<arc>(3);
+        _in_arcs = section_span<arc>(4);
+    }
+
+    // Checks in O(n + m) that the out and in arc begins are nondecreasing and
+    // bounded by the number of arcs, that the arc endpoints are vertices and
+    // that the in arcs are arcs. Throws std::runtime_error otherwise.
+    void validate() const {
+        auto valid_begins = [this](const std::span<const arc> begins) {
+            arc previous = 0;
+            for(auto && b : begins) {
+                if(b < previous || b > nb_arcs()) return false;
+                previous = b;
+            }
+            return true;
+        };
+        auto is_vertex = [this](const vertex u) { return is_valid_vertex(u); };
+        auto is_arc = [this](const arc a) { return is_valid_arc(a); };
+        if(!valid_begins(_out_arc_begin) || !valid_begins(_in_arc_begin) ||
+           !std::ranges::all_of(_arc_target, is_vertex) ||
+           !std::ranges::all_of(_arc_source, is_vertex) ||
+           !std::ranges::all_of(_in_arcs, is_arc))
+            throw std::runtime_error("Corrupted static_digraph file.");
+    }
+
+    basic_mapped_static_digraph(const basic_mapped_static_digraph &) = delete;
+    [[nodiscard]] basic_mapped_static_digraph(basic_mapped_static_digraph &&) =
+        default;
+
+    basic_mapped_static_digraph & operator=(
+        const basic_mapped_static_digraph &) = delete;
+    basic_mapped_static_digraph & operator=(basic_mapped_static_digraph &&) =
+        default;
+
+    [[nodiscard]] constexpr auto nb_vertices() const noexcept {
+        return _out_arc_begin.size();
+    }
+    [[nodiscard]] constexpr auto nb_arcs() const noexcept {
+        return _arc_target.size();
+    }
+
+    [[nodiscard]] constexpr bool is_valid_vertex(
+        const vertex u) const noexcept {
+        return u < nb_vertices();
+    }
+    [[nodiscard]] constexpr bool is_valid_arc(const arc u) const noexcept {
+        return u < nb_arcs();
+    }
+
+    [[nodiscard]] constexpr auto vertices() const noexcept {
+        return std::views::iota(static_cast<vertex>(0),
+                                static_cast<vertex>(nb_vertices()));
+    }
+    [[nodiscard]] constexpr auto arcs() const noexcept {
+        return std::views::iota(static_cast<arc>(0),
+                                static_cast<arc>(nb_arcs()));
+    }
+
+    [[nodiscard]] constexpr auto out_arcs(const vertex u) const noexcept {
+        assert(is_valid_vertex(u));
+        return std::views::iota(
+            _out_arc_begin[u],
+            (u + 1u < nb_vertices() ? _out_arc_begin[u + 1]
+                                    : static_cast<arc>(nb_arcs())));
+    }
+    [[nodiscard]] constexpr auto in_arcs(const vertex u) const noexcept {
+        assert(is_valid_vertex(u));
+        return _in_arcs.subspan(
+            _in_arc_begin[u],
+            (u + 1u < nb_vertices() ? _in_arc_begin[u + 1] : nb_arcs()) -
+                _in_arc_begin[u]);
+    }
+
+    [[nodiscard]] constexpr vertex arc_source(const arc a) const noexcept {
+        assert(is_valid_arc(a));
+        return _arc_source[a];
+    }
+    [[nodiscard]] constexpr vertex arc_target(const arc a) const noexcept {
+        assert(is_valid_arc(a));
+        return _arc_target[a];
+    }
+
+    [[nodiscard]] auto arc_sources_map() const noexcept { return _arc_source; }
+    [[nodiscard]] auto arc_targets_map() const noexcept { return _arc_target; }
+
+    [[nodiscard]] constexpr auto out_neighbors(const vertex u) const noexcept {
+        assert(is_valid_vertex(u));
+        return _arc_target.subspan(
+            _out_arc_begin[u],
+            (u + 1u < nb_vertices() ? _out_arc_begin[u + 1] : nb_arcs()) -
+                _out_arc_begin[u]);
+    }
+
+    template <typename T>
+    [[nodiscard]] constexpr auto create_vertex_map() const noexcept {
+        return static_map<vertex, T>(nb_vertices());
+    }
+    template <typename T>
+    [[nodiscard]] constexpr auto create_vertex_map(
+        const T & default_value) const noexcept {
+        return static_map<vertex, T>(nb_vertices(), default_value);
+    }
+
+    template <typename T>
+    [[nodiscard]] constexpr auto create_arc_map() const noexcept {
+        return static_map<arc, T>(nb_arcs());
+    }
+    template <typename T>
+    [[nodiscard]] constexpr auto create_arc_map(
+        const T & default_value) const noexcept {
+        return static_map<arc, T>(nb_arcs(), default_value);
+    }
+
+    [[nodiscard]] std::size_t nb_vertex_maps() const noexcept {
+        return _nb_vertex_maps;
+    }
+    [[nodiscard]] std::size_t nb_arc_maps() const noexcept {
+        return _nb_arc_maps;
+    }
+    // Zero-copy access to the i-th vertex map stored in the file
+    template <typename T>
+    [[nodiscard]] std::span<const T> vertex_map(const std::size_t i) const {
+        if(i >= _nb_vertex_maps) throw std::out_of_range("Invalid map index.");
+        return section_span<T>(__detail::static_digraph_file_nb_graph_sections +
+                               i);
+    }
+    // Zero-copy access to the i-th arc map stored in the file
+    template <typename T>
+    [[nodiscard]] std::span<const T> arc_map(const std::size_t i) const {
+        if(i >= _nb_arc_maps) throw std::out_of_range("Invalid map index.");
+        return section_span<T>(__detail::static_digraph_file_nb_graph_sections +
+                               _nb_vertex_maps + i);
+    }
+};
+
+template <typename V, typename A>
+mapped_static_digraph_writer(const basic_static_digraph<V, A> &)
+    -> mapped_static_digraph_writer<V, A>;
+
+using mapped_static_digraph = basic_mapped_static_digraph<>;
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_MAPPED_STATIC_DIGRAPH_HPP
@@ -0,0 +1,119 @@
+#ifndef MELON_PLAIN_D_ARY_HEAP_HPP
+#define MELON_PLAIN_D_ARY_HEAP_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace fhamonic {
+namespace melon {
+
+namespace __detail {
+struct greater_entry_priority {
+    [[nodiscard]] constexpr bool operator()(const auto & e1,
+                                            const auto & e2) const noexcept {
+        return e1.second > e2.second;
+    }
+};
+}  // namespace __detail
+
+// d-ary heap without indices map : it is cheaper than d_ary_heap since
+// moving an entry does not write to a map, but it can not promote keys.
+// A key may thus be pushed several times, e.g. by Dijkstra with lazy
+// deletion which skips the entries of already visited vertices.
+template <int D, typename K, typename P,
+          std::strict_weak_order<std::pair<K, P>, std::pair<K, P>> C =
+              __detail::greater_entry_priority>
+class plain_d_ary_heap {
+public:
+    using key_type = K;
+    using priority_type = P;
+    using entry = std::pair<key_type, priority_type>;
+
+private:
+    using size_type = std::size_t;
+
+    std::vector<entry> _heap_array;
+    C _cmp;
+
+public:
+    [[nodiscard]] constexpr plain_d_ary_heap() : _heap_array(), _cmp() {}
+
+    template <typename CA>
+    [[nodiscard]] constexpr explicit plain_d_ary_heap(CA && cmp_arg)
+        : _heap_array(), _cmp(std::forward<CA>(cmp_arg)) {}
+
+    [[nodiscard]] constexpr plain_d_ary_heap(const plain_d_ary_heap & bin) =
+        default;
+    [[nodiscard]] constexpr plain_d_ary_heap(plain_d_ary_heap && bin) =
+        default;
+
+    plain_d_ary_heap & operator=(const plain_d_ary_heap &) = default;
+    plain_d_ary_heap & operator=(plain_d_ary_heap &&) = default;
+
+    [[nodiscard]] constexpr size_type size() const noexcept {
+        return _heap_array.size();
+    }
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        return _heap_array.empty();
+    }
+    constexpr void clear() noexcept { _heap_array.resize(0); }
+
+private:
+    [[nodiscard]] static constexpr size_type parent_of(
+        const size_type i) noexcept {
+        return (i - 1) / D;
+    }
+    [[nodiscard]] static constexpr size_type first_child_of(
+        const size_type i) noexcept {
+        return i * D + 1;
+    }
+    [[nodiscard]] constexpr size_type minimum_child(
+        size_type child, const size_type end) const noexcept {
+        size_type minimum = child;
+        for(++child; child < end; ++child)
+            if(_cmp(_heap_array[child], _heap_array[minimum])) minimum = child;
+        return minimum;
+    }
+
+public:
+    void push(const key_type & k, const priority_type & p) noexcept {
+        entry e(k, p);
+        size_type hole_index = _heap_array.size();
+        _heap_array.emplace_back();
+        while(hole_index > 0) {
+            const size_type parent = parent_of(hole_index);
+            if(!_cmp(e, _heap_array[parent])) break;
+            _heap_array[hole_index] = std::move(_heap_array[parent]);
+            hole_index = parent;
+        }
+        _heap_array[hole_index] = std::move(e);
+    }
+    [[nodiscard]] constexpr entry top() const noexcept {
+        assert(!_heap_array.empty());
+        return _heap_array.front();
+    }
+    constexpr void pop() noexcept {
+        assert(!_heap_array.empty());
+        const size_type end = _heap_array.size() - 1;
+        entry e = std::move(_heap_array.back());
+        size_type hole_index = 0;
+        for(size_type child = first_child_of(0); child < end;
+            child = first_child_of(hole_index)) {
+            child = minimum_child(child, std::min(child + D, end));
+            if(!_cmp(_heap_array[child], e)) break;
+            _heap_array[hole_index] = std::move(_heap_array[child]);
+            hole_index = child;
+        }
+        _heap_array[hole_index] = std::move(e);
+        _heap_array.pop_back();
+    }
+};  // class plain_d_ary_heap
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_PLAIN_D_ARY_HEAP_HPP
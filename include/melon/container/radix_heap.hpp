@@ -0,0 +1,175 @@
+#ifndef MELON_RADIX_HEAP_HPP
+#define MELON_RADIX_HEAP_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <limits>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "melon/container/growable_map.hpp"
+#include "melon/utility/value_map.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Monotone min priority queue on non-negative integer priorities : pushed and
+// promoted priorities must not be smaller than the last popped one. An entry
+// of priority p lies in the bucket of index bit_width(p ^ last), so that
+// bucket 0 holds the entries of priority last and bucket i > 0 the entries
+// whose highest bit differing from last is the (i-1)th. When popping from an
+// empty bucket 0, last becomes the minimum of the first nonempty bucket which
+// is redistributed into lower buckets, each entry moving O(log C) times
+// overall for a maximum priority C.
+template <typename K, std::integral P,
+          output_value_map<K> M =
+              __detail::default_indices_map_t<K, std::size_t>>
+requires std::integral<mapped_value_t<M, K>>
+class radix_heap {
+public:
+    using key_type = K;
+    using priority_type = P;
+    using entry = std::pair<key_type, priority_type>;
+
+private:
+    using size_type = std::size_t;
+    using indice_map = M;
+    using bits_type = std::make_unsigned_t<P>;
+
+    static constexpr size_type nb_buckets =
+        std::numeric_limits<bits_type>::digits + 1;
+    static constexpr size_type bucket_bits = 8;
+
+    std::array<std::vector<entry>, nb_buckets> _buckets;
+    // (index in bucket << bucket_bits) | bucket
+    indice_map _indices_map;
+    priority_type _last;
+    size_type _size;
+
+public:
+    [[nodiscard]] constexpr radix_heap()
+        : _buckets(), _indices_map(), _last(0), _size(0) {}
+
+    template <typename IMA>
+    [[nodiscard]] constexpr explicit radix_heap(IMA && indice_map_arg)
+        : _buckets()
+        , _indices_map(std::forward<IMA>(indice_map_arg))
+        , _last(0)
+        , _size(0) {}
+
+    [[nodiscard]] constexpr radix_heap(const radix_heap & bin) = default;
+    [[nodiscard]] constexpr radix_heap(radix_heap && bin) = default;
+
+    radix_heap & operator=(const radix_heap &) = default;
+    radix_heap & operator=(radix_heap &&) = default;
+
+    [[nodiscard]] constexpr size_type size() const noexcept { return _size; }
+    [[nodiscard]] constexpr bool empty() const noexcept { return _size == 0; }
+    constexpr void clear() noexcept {
+        for(auto && bucket : _buckets) bucket.resize(0);
+        _last = 0;
+        _size = 0;
+    }
+
+private:
+    [[nodiscard]] constexpr size_type bucket_of(
+        const priority_type & p) const noexcept {
+        assert(p >= _last);
+        return static_cast<size_type>(std::bit_width(
+            static_cast<bits_type>(static_cast<bits_type>(p) ^
+                                   static_cast<bits_type>(_last))));
+    }
+    constexpr void bucket_push(const size_type b, entry && e) noexcept {
+        _indices_map[e.first] = (_buckets[b].size() << bucket_bits) | b;
+        _buckets[b].push_back(std::move(e));
+    }
+    constexpr entry bucket_erase(const size_type index) noexcept {
+        std::vector<entry> & bucket =
+            _buckets[index & ((size_type{1} << bucket_bits) - 1)];
+        const size_type i = index >> bucket_bits;
+        entry e = std::move(bucket[i]);
+        if(i + 1 < bucket.size()) {
+            bucket[i] = std::move(bucket.back());
+            _indices_map[bucket[i].first] = index;
+        }
+        bucket.pop_back();
+        return e;
+    }
+    [[nodiscard]] constexpr size_type first_nonempty_bucket() const noexcept {
+        size_type b = 0;
+        while(_buckets[b].empty()) ++b;
+        return b;
+    }
+    constexpr void refill_first_bucket() noexcept {
+        const size_type b = first_nonempty_bucket();
+        std::vector<entry> entries;
+        entries.swap(_buckets[b]);
+        _last = std::ranges::min(entries, {}, &entry::second).second;
+        // backward so that the entry returned by top() ends at the back of
+        // bucket 0
+        for(auto && e : std::views::reverse(entries))
+            bucket_push(bucket_of(e.second), std::move(e));
+        entries.resize(0);
+        entries.swap(_buckets[b]);
+    }
+    [[nodiscard]] constexpr size_type index_of(
+        const key_type & k) const noexcept {
+        if constexpr(requires() { std::as_const(_indices_map)[k]; })
+            return static_cast<size_type>(_indices_map[k]);
+        else
+            return static_cast<size_type>(_indices_map.at(k));
+    }
+    [[nodiscard]] constexpr const entry & entry_ref(
+        const size_type index) const noexcept {
+        return _buckets[index & ((size_type{1} << bucket_bits) - 1)]
+                       [index >> bucket_bits];
+    }
+
+public:
+    void push(const key_type & k, const priority_type & p) noexcept {
+        bucket_push(bucket_of(p), entry(k, p));
+        ++_size;
+    }
+    [[nodiscard]] constexpr priority_type priority(
+        const key_type & k) const noexcept {
+        return entry_ref(index_of(k)).second;
+    }
+    [[nodiscard]] constexpr bool contains(const key_type & k) const noexcept {
+        if constexpr(requires() { _indices_map.find(k); })
+            if(_indices_map.find(k) == _indices_map.end()) return false;
+        const size_type index = index_of(k);
+        const size_type b = index & ((size_type{1} << bucket_bits) - 1);
+        if(b >= nb_buckets || (index >> bucket_bits) >= _buckets[b].size())
+            return false;
+        return entry_ref(index).first == k;
+    }
+    [[nodiscard]] constexpr entry top() const noexcept {
+        assert(!empty());
+        if(!_buckets[0].empty()) return _buckets[0].back();
+        return std::ranges::min(_buckets[first_nonempty_bucket()], {},
+                                &entry::second);
+    }
+    constexpr void pop() noexcept {
+        assert(!empty());
+        if(_buckets[0].empty()) refill_first_bucket();
+        _buckets[0].pop_back();
+        --_size;
+    }
+    constexpr void promote(const key_type & k,
+                           const priority_type & p) noexcept {
+        assert(p < priority(k));
+        entry e = bucket_erase(_indices_map[k]);
+        e.second = p;
+        bucket_push(bucket_of(p), std::move(e));
+    }
+};  // class radix_heap
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_RADIX_HEAP_HPP
@@ -0,0 +1,239 @@
+#ifndef MELON_SOA_D_ARY_HEAP_HPP
+#define MELON_SOA_D_ARY_HEAP_HPP
+
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "melon/container/growable_map.hpp"
+#include "melon/detail/aligned_allocator.hpp"
+#include "melon/detail/simd_minimum.hpp"
+#include "melon/utility/value_map.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// d-ary heap storing keys and priorities in two separate arrays, so that the
+// D priorities compared when sifting down are contiguous. The arrays start
+// with D-1 unused slots, thus each group of siblings starts at a multiple of
+// D and lies in a single cache line when D * sizeof(P) <= 64. The minimum
+// child is selected with SSE4.1/AVX2 compares when the target has them, C is
+// std::less or std::greater and the D priorities fill whole registers, and
+// by a branchless tournament otherwise. The index map is written once per
+// sift, along the final path, rather than at each move. Unlike d_ary_heap,
+// C compares priorities instead of entries.
+template <int D, typename K, typename P,
+          std::strict_weak_order<P, P> C = std::greater<P>,
+          output_value_map<K> M =
+              __detail::default_indices_map_t<K, std::uint32_t>>
+requires std::integral<mapped_value_t<M, K>>
+class soa_d_ary_heap {
+public:
+    using key_type = K;
+    using priority_type = P;
+    using entry = std::pair<key_type, priority_type>;
+
+private:
+    using size_type = std::size_t;
+    using indice_map = M;
+    using index_type = mapped_value_t<M, K>;
+
+    static constexpr size_type root = D - 1;
+    static constexpr std::size_t cache_line_size = 64;
+
+    std::vector<key_type> _keys;
+    std::vector<priority_type,
+                __detail::aligned_allocator<priority_type, cache_line_size>>
+        _priorities;
+    indice_map _indices_map;
+    C _cmp;
+
+public:
+    [[nodiscard]] constexpr soa_d_ary_heap()
+        : _keys(root), _priorities(root), _indices_map(), _cmp() {}
+
+    template <typename IMA>
+    [[nodiscard]] constexpr explicit soa_d_ary_heap(IMA && indice_map_arg)
+        : _keys(root)
+        , _priorities(root)
+        , _indices_map(std::forward<IMA>(indice_map_arg))
+        , _cmp() {}
+
+    template <typename IMA, typename CA>
+    [[nodiscard]] constexpr soa_d_ary_heap(IMA && indice_map_arg,
+                                           CA && cmp_arg)
+        : _keys(root)
+        , _priorities(root)
+        , _indices_map(std::forward<IMA>(indice_map_arg))
+        , _cmp(std::forward<CA>(cmp_arg)) {}
+
+    [[nodiscard]] constexpr soa_d_ary_heap(const soa_d_ary_heap & bin) =
+        default;
+    [[nodiscard]] constexpr soa_d_ary_heap(soa_d_ary_heap && bin) = default;
+
+    soa_d_ary_heap & operator=(const soa_d_ary_heap &) = default;
+    soa_d_ary_heap & operator=(soa_d_ary_heap &&) = default;
+
+    [[nodiscard]] constexpr size_type size() const noexcept {
+        return _keys.size() - root;
+    }
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        return _keys.size() == root;
+    }
+    constexpr void clear() noexcept {
+        _keys.resize(root);
+        _priorities.resize(root);
+    }
+
+private:
+    [[nodiscard]] static constexpr size_type parent_of(
+        const size_type i) noexcept {
+        return i / D + D - 2;
+    }
+    [[nodiscard]] static constexpr size_type first_child_of(
+        const size_type i) noexcept {
+        return D * (i + 2 - D);
+    }
+    template <int I = D>
+    [[nodiscard]] constexpr size_type minimum_child(
+        const size_type first_child) const noexcept {
+        if constexpr(I == D && __detail::has_simd_minimum_index<D, P, C>)
+            return first_child + __detail::simd_minimum_index<D, C>(
+                                     _priorities.data() + first_child);
+        else if constexpr(I == 1)
+            return first_child;
+        else if constexpr(I == 2)
+            return first_child + _cmp(_priorities[first_child + 1],
+                                      _priorities[first_child]);
+        else {
+            const size_type first_half_minimum =
+                minimum_child<I / 2>(first_child);
+            const size_type second_half_minimum =
+                minimum_child<I - I / 2>(first_child + I / 2);
+            return _cmp(_priorities[second_half_minimum],
+                        _priorities[first_half_minimum])
+                       ? second_half_minimum
+                       : first_half_minimum;
+        }
+    }
+    [[nodiscard]] constexpr size_type minimum_remaining_child(
+        size_type child, const size_type end) const noexcept {
+        size_type minimum = child;
+        for(++child; child < end; ++child)
+            minimum = _cmp(_priorities[child], _priorities[minimum]) ? child
+                                                                     : minimum;
+        return minimum;
+    }
+
+    constexpr void heap_move(const size_type i, key_type && k,
+                             priority_type && p) noexcept {
+        _keys[i] = std::move(k);
+        _priorities[i] = std::move(p);
+    }
+    // Writes the indices of the keys from position i up to its ancestor last,
+    // the path of a sift, after the sift so that the index map accesses stay
+    // out of the chain of dependent priority comparisons.
+    constexpr void update_indices(size_type i, const size_type last) noexcept {
+        for(;; i = parent_of(i)) {
+            assert(i <= std::numeric_limits<index_type>::max());
+            _indices_map[_keys[i]] = static_cast<index_type>(i);
+            if(i == last) return;
+        }
+    }
+    constexpr void heap_push(size_type hole_index, key_type && k,
+                             priority_type && p) noexcept {
+        const size_type start_index = hole_index;
+        while(hole_index > root) {
+            const size_type parent = parent_of(hole_index);
+            if(!_cmp(p, _priorities[parent])) break;
+            heap_move(hole_index, std::move(_keys[parent]),
+                      std::move(_priorities[parent]));
+            hole_index = parent;
+        }
+        heap_move(hole_index, std::move(k), std::move(p));
+        update_indices(start_index, hole_index);
+    }
+    // EXPECTED_CPP23 goto in constexpr functions
+    void adjust_heap(size_type hole_index, const size_type end, key_type && k,
+                     priority_type && p) noexcept {
+        const size_type start_index = hole_index;
+        const size_type child_end = end >= D ? end - (D - 1) : 0;
+        size_type child = first_child_of(hole_index);
+        while(child < child_end) {
+            child = minimum_child(child);
+            if(_cmp(_priorities[child], p)) {
+                heap_move(hole_index, std::move(_keys[child]),
+                          std::move(_priorities[child]));
+                hole_index = child;
+                child = first_child_of(child);
+                continue;
+            }
+            goto ok;
+        }
+        if(child < end) {
+            child = minimum_remaining_child(child, end);
+            if(_cmp(_priorities[child], p)) {
+                heap_move(hole_index, std::move(_keys[child]),
+                          std::move(_priorities[child]));
+                hole_index = child;
+            }
+        }
+    ok:
+        heap_move(hole_index, std::move(k), std::move(p));
+        update_indices(hole_index, start_index);
+    }
+    [[nodiscard]] constexpr size_type index_of(
+        const key_type & k) const noexcept {
+        if constexpr(requires() { std::as_const(_indices_map)[k]; })
+            return static_cast<size_type>(_indices_map[k]);
+        else
+            return static_cast<size_type>(_indices_map.at(k));
+    }
+
+public:
+    void push(const key_type & k, const priority_type & p) noexcept {
+        const size_type n = _keys.size();
+        _keys.emplace_back();
+        _priorities.emplace_back();
+        heap_push(n, key_type(k), priority_type(p));
+    }
+    [[nodiscard]] constexpr priority_type priority(
+        const key_type & k) const noexcept {
+        return _priorities[index_of(k)];
+    }
+    [[nodiscard]] constexpr bool contains(const key_type & k) const noexcept {
+        const size_type i = index_of(k);
+        if(i < root || i >= _keys.size()) return false;
+        return _keys[i] == k;
+    }
+    [[nodiscard]] constexpr entry top() const noexcept {
+        assert(!empty());
+        return entry(_keys[root], _priorities[root]);
+    }
+    constexpr void pop() noexcept {
+        assert(!empty());
+        const size_type n = _keys.size() - 1;
+        if(n > root)
+            adjust_heap(root, n, std::move(_keys.back()),
+                        std::move(_priorities.back()));
+        _keys.pop_back();
+        _priorities.pop_back();
+    }
+    constexpr void promote(const key_type & k,
+                           const priority_type & p) noexcept {
+        assert(_cmp(p, _priorities[index_of(k)]));
+        heap_push(index_of(k), key_type(k), priority_type(p));
+    }
+    void demote(const key_type & k, const priority_type & p) noexcept {
+        assert(_cmp(_priorities[index_of(k)], p));
+        adjust_heap(index_of(k), _keys.size(), key_type(k), priority_type(p));
+    }
+};  // class soa_d_ary_heap
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_SOA_D_ARY_HEAP_HPP
@@ -2,23 +2,28 @@
 #define MELON_STATIC_DIGRAPH_HPP
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <concepts>
 #include <numeric>
 #include <ranges>
 #include <span>
 #include <vector>
 
 #include "melon/container/static_map.hpp"
+#include "melon/detail/parallel.hpp"
 #include "melon/detail/range_of.hpp"
 #include "melon/utility/value_map.hpp"
 
 namespace fhamonic {
 namespace melon {
 
-class static_digraph {
+template <std::unsigned_integral V = unsigned int,
+          std::unsigned_integral A = unsigned int>
+class basic_static_digraph {
 private:
-    using vertex = unsigned int;
-    using arc = unsigned int;
+    using vertex = V;
+    using arc = A;
 
     static_map<vertex, arc> _out_arc_begin;
     static_map<arc, vertex> _arc_target;
@@ -29,8 +34,8 @@ private:
 
 public:
     template <forward_range_of<vertex> S, forward_range_of<vertex> T>
-    [[nodiscard]] static_digraph(const std::size_t & nb_vertices, S && sources,
-                                 T && targets) noexcept
+    [[nodiscard]] basic_static_digraph(const std::size_t & nb_vertices,
+                                       S && sources, T && targets) noexcept
         : _out_arc_begin(nb_vertices, 0)
         , _arc_target(std::forward<T>(targets))
         , _arc_source(std::forward<S>(sources))
@@ -46,13 +51,13 @@ public:
         for(auto && t : targets) ++in_arc_count[t];
         std::exclusive_scan(_out_arc_begin.data(),
                             _out_arc_begin.data() + nb_vertices,
-                            _out_arc_begin.data(), 0);
+                            _out_arc_begin.data(), arc{0});
         std::exclusive_scan(in_arc_count.data(),
                             in_arc_count.data() + nb_vertices,
-                            _in_arc_begin.data(), 0);
+                            _in_arc_begin.data(), arc{0});
         for(auto && a : arcs()) {
             vertex t = _arc_target[a];
-            arc end = (t + 1 < static_cast<vertex>(nb_vertices)
+            arc end = (t + 1u < nb_vertices
                            ? _in_arc_begin[t + 1]
                            : static_cast<arc>(nb_arcs()));
             _in_arcs[end - in_arc_count[t]] = a;
@@ -60,12 +65,69 @@ public:
         }
     }
 
-    [[nodiscard]] static_digraph() = default;
-    [[nodiscard]] static_digraph(const static_digraph & graph) = default;
-    [[nodiscard]] static_digraph(static_digraph && graph) = default;
-
-    static_digraph & operator=(const static_digraph &) = default;
-    static_digraph & operator=(static_digraph &&) = default;
+    // Multithreaded construction producing the same graph as the serial one.
+    // In arcs are scattered with atomic cursors, then each in arcs list is
+    // sorted to recover the increasing arc order of the serial scatter.
+    template <random_access_range_of<vertex> S,
+              random_access_range_of<vertex> T>
+    [[nodiscard]] basic_static_digraph(const parallel_policy & policy,
+                                       const std::size_t & nb_vertices,
+                                       S && sources, T && targets)
+        : _out_arc_begin(nb_vertices)
+        , _arc_target(std::forward<T>(targets))
+        , _arc_source(std::forward<S>(sources))
+        , _in_arc_begin(nb_vertices)
+        , _in_arcs(_arc_target.size()) {
+        assert(std::all_of(_arc_source.data(),
+                           _arc_source.data() + _arc_source.size(),
+                           [n = nb_vertices](auto && v) { return v < n; }));
+        assert(std::all_of(_arc_target.data(),
+                           _arc_target.data() + _arc_target.size(),
+                           [n = nb_vertices](auto && v) { return v < n; }));
+        assert(std::is_sorted(_arc_source.data(),
+                              _arc_source.data() + _arc_source.size()));
+        const std::size_t m = nb_arcs();
+        __detail::parallel_sorted_keys_begins(
+            policy, _arc_source.data(), m, _out_arc_begin.data(), nb_vertices);
+
+        static_map<vertex, arc> in_arc_cursor(nb_vertices);
+        __detail::parallel_for(policy, nb_vertices, [&](std::size_t u) {
+            in_arc_cursor[static_cast<vertex>(u)] = 0;
+        });
+        __detail::parallel_for(policy, m, [&](std::size_t a) {
+            std::atomic_ref<arc>(in_arc_cursor[_arc_target[static_cast<arc>(a)]])
+                .fetch_add(1, std::memory_order_relaxed);
+        });
+        __detail::parallel_exclusive_scan(policy, in_arc_cursor.data(),
+                                          nb_vertices, _in_arc_begin.data(),
+                                          arc{0});
+        __detail::parallel_for(policy, nb_vertices, [&](std::size_t u) {
+            in_arc_cursor[static_cast<vertex>(u)] =
+                _in_arc_begin[static_cast<vertex>(u)];
+        });
+        __detail::parallel_for(policy, m, [&](std::size_t a) {
+            const arc i =
+                std::atomic_ref<arc>(
+                    in_arc_cursor[_arc_target[static_cast<arc>(a)]])
+                    .fetch_add(1, std::memory_order_relaxed);
+            _in_arcs[i] = static_cast<arc>(a);
+        });
+        __detail::parallel_for(policy, nb_vertices, [&](std::size_t u) {
+            std::sort(_in_arcs.data() + _in_arc_begin[static_cast<vertex>(u)],
+                      (u + 1u < nb_vertices
+                           ? _in_arcs.data() +
+                                 _in_arc_begin[static_cast<vertex>(u + 1)]
+                           : _in_arcs.data() + m));
+        });
+    }
+
+    [[nodiscard]] basic_static_digraph() = default;
+    [[nodiscard]] basic_static_digraph(const basic_static_digraph & graph) =
+        default;
+    [[nodiscard]] basic_static_digraph(basic_static_digraph && graph) = default;
+
+    basic_static_digraph & operator=(const basic_static_digraph &) = default;
+    basic_static_digraph & operator=(basic_static_digraph &&) = default;
 
     [[nodiscard]] constexpr auto nb_vertices() const noexcept {
         return _out_arc_begin.size();
@@ -95,14 +157,15 @@ public:
         assert(is_valid_vertex(u));
         return std::views::iota(
             _out_arc_begin[u],
-            (u + 1 < nb_vertices() ? _out_arc_begin[u + 1] : nb_arcs()));
+            (u + 1u < nb_vertices() ? _out_arc_begin[u + 1]
+                                    : static_cast<arc>(nb_arcs())));
     }
     [[nodiscard]] constexpr auto in_arcs(const vertex u) const noexcept {
         assert(is_valid_vertex(u));
         return std::span(
             _in_arcs.data() + _in_arc_begin[u],
-            (u + 1 < nb_vertices() ? _in_arcs.data() + _in_arc_begin[u + 1]
-                                   : _in_arcs.data() + nb_arcs()));
+            (u + 1u < nb_vertices() ? _in_arcs.data() + _in_arc_begin[u + 1]
+                                    : _in_arcs.data() + nb_arcs()));
     }
 
     [[nodiscard]] constexpr vertex arc_source(const arc a) const noexcept {
@@ -125,8 +188,9 @@ public:
         assert(is_valid_vertex(u));
         return std::span(
             _arc_target.data() + _out_arc_begin[u],
-            (u + 1 < nb_vertices() ? _arc_target.data() + _out_arc_begin[u + 1]
-                                   : _arc_target.data() + nb_arcs()));
+            (u + 1u < nb_vertices()
+                 ? _arc_target.data() + _out_arc_begin[u + 1]
+                 : _arc_target.data() + nb_arcs()));
     }
 
     template <typename T>
@@ -150,6 +214,8 @@ public:
     }
 };
 
+using static_digraph = basic_static_digraph<>;
+
 }  // namespace melon
 }  // namespace fhamonic
 
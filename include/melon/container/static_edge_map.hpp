@@ -0,0 +1,70 @@
+#ifndef MELON_STATIC_EDGE_MAP_HPP
+#define MELON_STATIC_EDGE_MAP_HPP
+
+#include <cassert>
+#include <concepts>
+#include <ranges>
+
+#include "melon/container/static_map.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Map storing one value per edge of an undirected graph whose arcs are the
+// two orientations 2e and 2e+1 of each edge e, and looking up arcs into
+// it. Thus writing the value of an arc also changes the one of its reverse.
+// It does not provide data() since arc keys are not offsets in the storage.
+template <std::unsigned_integral A, typename T>
+class static_edge_map {
+public:
+    using key_type = A;
+    using mapped_type = T;
+    using size_type = std::size_t;
+
+private:
+    static_map<A, T> _edge_values;
+
+public:
+    [[nodiscard]] constexpr static_edge_map() noexcept = default;
+    [[nodiscard]] constexpr explicit static_edge_map(const size_type nb_edges)
+        : _edge_values(nb_edges) {}
+    [[nodiscard]] constexpr static_edge_map(const size_type nb_edges,
+                                            const mapped_type & init_value)
+        : _edge_values(nb_edges, init_value) {}
+    // Values of the edges in increasing edge order
+    template <std::ranges::random_access_range R>
+    [[nodiscard]] constexpr explicit static_edge_map(R && edge_values)
+        : _edge_values(std::forward<R>(edge_values)) {}
+
+    [[nodiscard]] constexpr static_edge_map(const static_edge_map &) = default;
+    [[nodiscard]] constexpr static_edge_map(static_edge_map &&) = default;
+    static_edge_map & operator=(const static_edge_map &) = default;
+    static_edge_map & operator=(static_edge_map &&) = default;
+
+    [[nodiscard]] constexpr size_type size() const noexcept {
+        return _edge_values.size();
+    }
+
+    [[nodiscard]] constexpr mapped_type & operator[](const key_type a) noexcept {
+        return _edge_values[static_cast<key_type>(a >> 1)];
+    }
+    [[nodiscard]] constexpr const mapped_type & operator[](
+        const key_type a) const noexcept {
+        return _edge_values[static_cast<key_type>(a >> 1)];
+    }
+
+    [[nodiscard]] constexpr static_map<A, T> & edge_values() noexcept {
+        return _edge_values;
+    }
+    [[nodiscard]] constexpr const static_map<A, T> & edge_values()
+        const noexcept {
+        return _edge_values;
+    }
+
+    void fill(const mapped_type & v) noexcept { _edge_values.fill(v); }
+};
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_STATIC_EDGE_MAP_HPP
@@ -3,29 +3,33 @@
 
 #include <algorithm>
 #include <cassert>
+#include <concepts>
 #include <numeric>
 #include <ranges>
 #include <span>
 #include <vector>
 
 #include "melon/container/static_map.hpp"
+#include "melon/detail/parallel.hpp"
 #include "melon/detail/range_of.hpp"
 
 namespace fhamonic {
 namespace melon {
 
-class static_forward_digraph {
+template <std::unsigned_integral V = unsigned int,
+          std::unsigned_integral A = unsigned int>
+class basic_static_forward_digraph {
 private:
-    using vertex = unsigned int;
-    using arc = unsigned int;
+    using vertex = V;
+    using arc = A;
 
     static_map<vertex, arc> _out_arc_begin;
     static_map<arc, vertex> _arc_target;
 
 public:
     template <forward_range_of<vertex> S, forward_range_of<vertex> T>
-    static_forward_digraph(const std::size_t & nb_vertices, S && sources,
-                           T && targets) noexcept
+    basic_static_forward_digraph(const std::size_t & nb_vertices,
+                                 S && sources, T && targets) noexcept
         : _out_arc_begin(nb_vertices, 0), _arc_target(std::move(targets)) {
         assert(std::ranges::all_of(
             sources, [n = nb_vertices](auto && v) { return v < n; }));
@@ -35,16 +39,36 @@ public:
         for(auto && s : sources) ++_out_arc_begin[s];
         std::exclusive_scan(_out_arc_begin.data(),
                             _out_arc_begin.data() + nb_vertices,
-                            _out_arc_begin.data(), 0);
+                            _out_arc_begin.data(), arc{0});
     }
 
-    static_forward_digraph() = default;
-    static_forward_digraph(const static_forward_digraph & graph) = default;
-    static_forward_digraph(static_forward_digraph && graph) = default;
+    template <random_access_range_of<vertex> S,
+              random_access_range_of<vertex> T>
+    basic_static_forward_digraph(const parallel_policy & policy,
+                                 const std::size_t & nb_vertices,
+                                 S && sources, T && targets)
+        : _out_arc_begin(nb_vertices), _arc_target(std::move(targets)) {
+        assert(std::ranges::all_of(
+            sources, [n = nb_vertices](auto && v) { return v < n; }));
+        assert(std::ranges::all_of(
+            targets, [n = nb_vertices](auto && v) { return v < n; }));
+        assert(std::ranges::is_sorted(sources));
+        __detail::parallel_sorted_keys_begins(
+            policy, std::ranges::begin(sources),
+            static_cast<std::size_t>(std::ranges::distance(sources)),
+            _out_arc_begin.data(), nb_vertices);
+    }
 
-    static_forward_digraph & operator=(const static_forward_digraph &) =
+    basic_static_forward_digraph() = default;
+    basic_static_forward_digraph(const basic_static_forward_digraph & graph) =
+        default;
+    basic_static_forward_digraph(basic_static_forward_digraph && graph) =
+        default;
+
+    basic_static_forward_digraph & operator=(
+        const basic_static_forward_digraph &) = default;
+    basic_static_forward_digraph & operator=(basic_static_forward_digraph &&) =
         default;
-    static_forward_digraph & operator=(static_forward_digraph &&) = default;
 
     auto nb_vertices() const noexcept { return _out_arc_begin.size(); }
     auto nb_arcs() const noexcept { return _arc_target.size(); }
@@ -66,7 +90,8 @@ public:
         assert(is_valid_vertex(u));
         return std::views::iota(
             _out_arc_begin[u],
-            (u + 1 < nb_vertices() ? _out_arc_begin[u + 1] : nb_arcs()));
+            (u + 1u < nb_vertices() ? _out_arc_begin[u + 1]
+                                    : static_cast<arc>(nb_arcs())));
     }
     vertex arc_target(const arc & a) const noexcept {
         assert(is_valid_arc(a));
@@ -77,8 +102,9 @@ public:
         assert(is_valid_vertex(u));
         return std::span(
             _arc_target.data() + _out_arc_begin[u],
-            (u + 1 < nb_vertices() ? _arc_target.data() + _out_arc_begin[u + 1]
-                                   : _arc_target.data() + nb_arcs()));
+            (u + 1u < nb_vertices()
+                 ? _arc_target.data() + _out_arc_begin[u + 1]
+                 : _arc_target.data() + nb_arcs()));
     }
 
     template <typename T>
@@ -101,6 +127,8 @@ public:
     }
 };
 
+using static_forward_digraph = basic_static_forward_digraph<>;
+
 }  // namespace melon
 }  // namespace fhamonic
 
@@ -0,0 +1,169 @@
+#ifndef MELON_STATIC_FORWARD_WEIGHTED_DIGRAPH_HPP
+#define MELON_STATIC_FORWARD_WEIGHTED_DIGRAPH_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "melon/container/static_map.hpp"
+#include "melon/detail/range_of.hpp"
+#include "melon/utility/value_map.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Forward CSR digraph storing the target and the weight of each arc side by
+// side, so that scanning the out arcs of a vertex with their weights streams
+// a single array.
+template <typename W, std::unsigned_integral V = unsigned int,
+          std::unsigned_integral A = unsigned int>
+class static_forward_weighted_digraph {
+private:
+    using vertex = V;
+    using arc = A;
+    using weight = W;
+    using arc_entry = std::pair<vertex, weight>;
+
+    static_map<vertex, arc> _out_arc_begin;
+    static_map<arc, arc_entry> _arc_entries;
+
+public:
+    class arc_weights_map_type {
+    private:
+        const arc_entry * _entries;
+
+    public:
+        [[nodiscard]] constexpr arc_weights_map_type(
+            const arc_entry * entries = nullptr) noexcept
+            : _entries(entries) {}
+
+        [[nodiscard]] constexpr const weight & operator[](
+            const arc & a) const noexcept {
+            return _entries[a].second;
+        }
+    };
+
+    template <forward_range_of<vertex> S, forward_range_of<vertex> T,
+              forward_range_of<weight> Wr>
+    static_forward_weighted_digraph(const std::size_t & nb_vertices,
+                                    S && sources, T && targets,
+                                    Wr && weights) noexcept
+        : _out_arc_begin(nb_vertices, 0)
+        , _arc_entries(
+              static_cast<std::size_t>(std::ranges::distance(targets))) {
+        assert(std::ranges::all_of(
+            sources, [n = nb_vertices](auto && v) { return v < n; }));
+        assert(std::ranges::all_of(
+            targets, [n = nb_vertices](auto && v) { return v < n; }));
+        assert(std::ranges::is_sorted(sources));
+        assert(std::ranges::distance(weights) ==
+               std::ranges::distance(targets));
+        for(auto && s : sources) ++_out_arc_begin[s];
+        std::exclusive_scan(_out_arc_begin.data(),
+                            _out_arc_begin.data() + nb_vertices,
+                            _out_arc_begin.data(), arc{0});
+        auto entries_it = _arc_entries.data();
+        auto weights_it = std::ranges::begin(weights);
+        for(auto && t : targets) {
+            *entries_it = arc_entry(t, *weights_it);
+            ++entries_it;
+            ++weights_it;
+        }
+    }
+
+    static_forward_weighted_digraph() = default;
+    static_forward_weighted_digraph(
+        const static_forward_weighted_digraph & graph) = default;
+    static_forward_weighted_digraph(static_forward_weighted_digraph && graph) =
+        default;
+
+    static_forward_weighted_digraph & operator=(
+        const static_forward_weighted_digraph &) = default;
+    static_forward_weighted_digraph & operator=(
+        static_forward_weighted_digraph &&) = default;
+
+    auto nb_vertices() const noexcept { return _out_arc_begin.size(); }
+    auto nb_arcs() const noexcept { return _arc_entries.size(); }
+
+    bool is_valid_vertex(const vertex & u) const noexcept {
+        return u < nb_vertices();
+    }
+    bool is_valid_arc(const arc & u) const noexcept { return u < nb_arcs(); }
+
+    auto vertices() const noexcept {
+        return std::views::iota(static_cast<vertex>(0),
+                                static_cast<vertex>(nb_vertices()));
+    }
+    auto arcs() const noexcept {
+        return std::views::iota(static_cast<arc>(0),
+                                static_cast<arc>(nb_arcs()));
+    }
+    auto out_arcs(const vertex & u) const noexcept {
+        assert(is_valid_vertex(u));
+        return std::views::iota(
+            _out_arc_begin[u],
+            (u + 1u < nb_vertices() ? _out_arc_begin[u + 1]
+                                    : static_cast<arc>(nb_arcs())));
+    }
+    vertex arc_target(const arc & a) const noexcept {
+        assert(is_valid_arc(a));
+        return _arc_entries[a].first;
+    }
+    auto arc_targets_map() const noexcept {
+        return views::map(
+            [entries = _arc_entries.data()](const arc & a) -> vertex {
+                return entries[a].first;
+            });
+    }
+    const weight & arc_weight(const arc & a) const noexcept {
+        assert(is_valid_arc(a));
+        return _arc_entries[a].second;
+    }
+    arc_weights_map_type arc_weights_map() const noexcept {
+        return arc_weights_map_type(_arc_entries.data());
+    }
+
+    // Contiguous (target, weight) pairs of the out arcs of u, in the order of
+    // out_arcs(u)
+    std::span<const arc_entry> out_weighted_neighbors(
+        const vertex & u) const noexcept {
+        assert(is_valid_vertex(u));
+        return std::span(
+            _arc_entries.data() + _out_arc_begin[u],
+            (u + 1u < nb_vertices()
+                 ? _arc_entries.data() + _out_arc_begin[u + 1]
+                 : _arc_entries.data() + nb_arcs()));
+    }
+    auto out_neighbors(const vertex & u) const noexcept {
+        return std::views::keys(out_weighted_neighbors(u));
+    }
+
+    template <typename T>
+    static_map<vertex, T> create_vertex_map() const noexcept {
+        return static_map<vertex, T>(nb_vertices());
+    }
+    template <typename T>
+    static_map<vertex, T> create_vertex_map(
+        const T & default_value) const noexcept {
+        return static_map<vertex, T>(nb_vertices(), default_value);
+    }
+
+    template <typename T>
+    static_map<arc, T> create_arc_map() const noexcept {
+        return static_map<arc, T>(nb_arcs());
+    }
+    template <typename T>
+    static_map<arc, T> create_arc_map(const T & default_value) const noexcept {
+        return static_map<arc, T>(nb_arcs(), default_value);
+    }
+};
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_STATIC_FORWARD_WEIGHTED_DIGRAPH_HPP
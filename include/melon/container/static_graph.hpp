@@ -0,0 +1,173 @@
+#ifndef MELON_STATIC_GRAPH_HPP
+#define MELON_STATIC_GRAPH_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <vector>
+
+#include "melon/container/static_edge_map.hpp"
+#include "melon/container/static_map.hpp"
+#include "melon/detail/range_of.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Undirected graph storing each edge e once. Its arcs are the two
+// orientations of the edges : arc 2e goes from the first endpoint of e to
+// the second and arc 2e+1 the other way, so that the graph is seen as a
+// symmetric digraph by the algorithms. Edge maps store one value per edge
+// and are indexed by arcs, arc maps store one value per orientation.
+template <std::unsigned_integral V = unsigned int,
+          std::unsigned_integral A = unsigned int>
+class basic_static_graph {
+private:
+    using vertex = V;
+    using arc = A;
+    using edge = A;
+
+    static_map<vertex, arc> _out_arc_begin;
+    static_map<arc, arc> _out_arcs;
+    static_map<arc, vertex> _arc_source;
+
+public:
+    // Edge e is (sources[e], targets[e]), in any order.
+    template <forward_range_of<vertex> S, forward_range_of<vertex> T>
+    [[nodiscard]] basic_static_graph(const std::size_t & nb_vertices,
+                                     S && sources, T && targets)
+        : _out_arc_begin(nb_vertices, 0)
+        , _out_arcs(2 * static_cast<std::size_t>(
+                            std::ranges::distance(sources)))
+        , _arc_source(_out_arcs.size()) {
+        assert(std::ranges::all_of(
+            sources, [n = nb_vertices](auto && v) { return v < n; }));
+        assert(std::ranges::all_of(
+            targets, [n = nb_vertices](auto && v) { return v < n; }));
+        assert(std::ranges::distance(sources) ==
+               std::ranges::distance(targets));
+        arc i = 0;
+        for(auto && s : sources) {
+            _arc_source[i] = s;
+            i += 2;
+        }
+        i = 1;
+        for(auto && t : targets) {
+            _arc_source[i] = t;
+            i += 2;
+        }
+        static_map<vertex, arc> out_arc_count(nb_vertices, 0);
+        for(auto && a : arcs()) ++out_arc_count[_arc_source[a]];
+        std::exclusive_scan(out_arc_count.data(),
+                            out_arc_count.data() + nb_vertices,
+                            _out_arc_begin.data(), arc{0});
+        std::copy(_out_arc_begin.data(), _out_arc_begin.data() + nb_vertices,
+                  out_arc_count.data());
+        for(auto && a : arcs()) _out_arcs[out_arc_count[_arc_source[a]]++] = a;
+    }
+
+    [[nodiscard]] basic_static_graph() = default;
+    [[nodiscard]] basic_static_graph(const basic_static_graph & graph) =
+        default;
+    [[nodiscard]] basic_static_graph(basic_static_graph && graph) = default;
+
+    basic_static_graph & operator=(const basic_static_graph &) = default;
+    basic_static_graph & operator=(basic_static_graph &&) = default;
+
+    [[nodiscard]] constexpr auto nb_vertices() const noexcept {
+        return _out_arc_begin.size();
+    }
+    [[nodiscard]] constexpr auto nb_arcs() const noexcept {
+        return _arc_source.size();
+    }
+    [[nodiscard]] constexpr auto nb_edges() const noexcept {
+        return _arc_source.size() / 2;
+    }
+
+    [[nodiscard]] constexpr bool is_valid_vertex(
+        const vertex u) const noexcept {
+        return u < nb_vertices();
+    }
+    [[nodiscard]] constexpr bool is_valid_arc(const arc a) const noexcept {
+        return a < nb_arcs();
+    }
+
+    [[nodiscard]] constexpr auto vertices() const noexcept {
+        return std::views::iota(static_cast<vertex>(0),
+                                static_cast<vertex>(nb_vertices()));
+    }
+    [[nodiscard]] constexpr auto arcs() const noexcept {
+        return std::views::iota(static_cast<arc>(0),
+                                static_cast<arc>(nb_arcs()));
+    }
+    [[nodiscard]] constexpr auto edges() const noexcept {
+        return std::views::iota(static_cast<edge>(0),
+                                static_cast<edge>(nb_edges()));
+    }
+
+    [[nodiscard]] static constexpr edge arc_edge(const arc a) noexcept {
+        return a >> 1;
+    }
+    [[nodiscard]] static constexpr arc reverse_arc(const arc a) noexcept {
+        return a ^ 1;
+    }
+
+    [[nodiscard]] constexpr auto out_arcs(const vertex u) const noexcept {
+        assert(is_valid_vertex(u));
+        return std::span(
+            _out_arcs.data() + _out_arc_begin[u],
+            (u + 1u < nb_vertices() ? _out_arcs.data() + _out_arc_begin[u + 1]
+                                    : _out_arcs.data() + nb_arcs()));
+    }
+    [[nodiscard]] constexpr auto in_arcs(const vertex u) const noexcept {
+        return std::views::transform(out_arcs(u), reverse_arc);
+    }
+
+    [[nodiscard]] constexpr vertex arc_source(const arc a) const noexcept {
+        assert(is_valid_arc(a));
+        return _arc_source[a];
+    }
+    [[nodiscard]] constexpr vertex arc_target(const arc a) const noexcept {
+        assert(is_valid_arc(a));
+        return _arc_source[reverse_arc(a)];
+    }
+
+    template <typename T>
+    [[nodiscard]] constexpr auto create_vertex_map() const noexcept {
+        return static_map<vertex, T>(nb_vertices());
+    }
+    template <typename T>
+    [[nodiscard]] constexpr auto create_vertex_map(
+        const T & default_value) const noexcept {
+        return static_map<vertex, T>(nb_vertices(), default_value);
+    }
+
+    template <typename T>
+    [[nodiscard]] constexpr auto create_arc_map() const noexcept {
+        return static_map<arc, T>(nb_arcs());
+    }
+    template <typename T>
+    [[nodiscard]] constexpr auto create_arc_map(
+        const T & default_value) const noexcept {
+        return static_map<arc, T>(nb_arcs(), default_value);
+    }
+
+    template <typename T>
+    [[nodiscard]] constexpr auto create_edge_map() const noexcept {
+        return static_edge_map<arc, T>(nb_edges());
+    }
+    template <typename T>
+    [[nodiscard]] constexpr auto create_edge_map(
+        const T & default_value) const noexcept {
+        return static_edge_map<arc, T>(nb_edges(), default_value);
+    }
+};
+
+using static_graph = basic_static_graph<>;
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_STATIC_GRAPH_HPP
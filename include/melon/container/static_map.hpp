@@ -182,7 +182,7 @@ public:
 }  // namespace melon
 }  // namespace fhamonic
 
-// #include "melon/container/static_map_atomic_bool.hpp"
+#include "melon/container/static_map_atomic_bool.hpp"
 // #include "melon/container/static_map_bool.hpp"
 
 #endif  // MELON_STATIC_MAP_HPP
\ No newline at end of file
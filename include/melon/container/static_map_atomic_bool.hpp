@@ -0,0 +1,244 @@
+#ifndef MELON_STATIC_MAP_ATOMIC_BOOL_HPP
+#define MELON_STATIC_MAP_ATOMIC_BOOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <compare>
+#include <concepts>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+#include "melon/container/static_map.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Bitset that several threads can read and write at once. The bits are
+// packed in atomic words and written with fetch_or and fetch_and, thus
+// test_and_set lets exactly one of the threads setting a key observe it
+// unset, e.g. to claim a vertex in a parallel traversal. Iterating over
+// the map gives (key, bool) pairs read with relaxed loads.
+template <typename K>
+requires std::integral<K>
+class static_map<K, std::atomic<bool>> {
+public:
+    using key_type = K;
+    using mapped_type = bool;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+private:
+    using span_type = std::size_t;
+    static_assert(std::atomic<span_type>::is_always_lock_free);
+    static constexpr size_type N = sizeof(span_type) << 3;
+    static constexpr size_type span_index_mask = N - 1;
+    [[nodiscard]] static constexpr size_type nb_spans(const size_type n) {
+        return (n + N - 1) / N;
+    }
+    [[nodiscard]] static constexpr span_type mask_of(const size_type i) {
+        return span_type(1) << (i & span_index_mask);
+    }
+
+public:
+    class reference {
+    private:
+        std::atomic<span_type> * _p;
+        span_type _mask;
+
+    public:
+        [[nodiscard]] constexpr reference(std::atomic<span_type> * p,
+                                          const size_type i) noexcept
+            : _p(p), _mask(mask_of(i)) {}
+        [[nodiscard]] constexpr reference(const reference &) = default;
+
+        operator bool() const noexcept {
+            return (_p->load(std::memory_order_relaxed) & _mask) != 0;
+        }
+        reference & operator=(const bool b) noexcept {
+            if(b)
+                _p->fetch_or(_mask, std::memory_order_relaxed);
+            else
+                _p->fetch_and(~_mask, std::memory_order_relaxed);
+            return *this;
+        }
+        reference & operator=(const reference & other) noexcept {
+            return *this = bool(other);
+        }
+    };
+    using const_reference = bool;
+
+    class iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = std::pair<const K, bool>;
+        using pointer = void;
+        using reference = value_type;
+
+    private:
+        const std::atomic<span_type> * _p;
+        size_type _index;
+
+    public:
+        [[nodiscard]] constexpr iterator(const std::atomic<span_type> * p,
+                                         const size_type & index)
+            : _p(p), _index(index) {}
+
+        [[nodiscard]] constexpr iterator() = default;
+        [[nodiscard]] constexpr iterator(const iterator &) = default;
+        constexpr iterator & operator=(const iterator &) = default;
+
+        [[nodiscard]] constexpr friend bool operator==(
+            const iterator & x, const iterator & y) noexcept {
+            return x._p == y._p && x._index == y._index;
+        }
+        [[nodiscard]] friend constexpr std::strong_ordering operator<=>(
+            const iterator & x, const iterator & y) noexcept {
+            assert(x._p == y._p);
+            return x._index <=> y._index;
+        }
+        [[nodiscard]] constexpr difference_type operator-(
+            const iterator & other) const noexcept {
+            assert(_p == other._p);
+            return static_cast<difference_type>(_index) -
+                   static_cast<difference_type>(other._index);
+        }
+        constexpr iterator & operator++() noexcept {
+            ++_index;
+            return *this;
+        }
+        [[nodiscard]] constexpr iterator operator++(int) noexcept {
+            iterator tmp = *this;
+            ++_index;
+            return tmp;
+        }
+        constexpr iterator & operator--() noexcept {
+            --_index;
+            return *this;
+        }
+        [[nodiscard]] constexpr iterator operator--(int) noexcept {
+            iterator tmp = *this;
+            --_index;
+            return tmp;
+        }
+        constexpr iterator & operator+=(difference_type i) noexcept {
+            _index += static_cast<size_type>(i);
+            return *this;
+        }
+        constexpr iterator & operator-=(difference_type i) noexcept {
+            _index -= static_cast<size_type>(i);
+            return *this;
+        }
+        [[nodiscard]] constexpr friend iterator operator+(const iterator & x,
+                                                          difference_type n) {
+            iterator tmp = x;
+            return tmp += n;
+        }
+        [[nodiscard]] constexpr friend iterator operator+(difference_type n,
+                                                          const iterator & x) {
+            return x + n;
+        }
+        [[nodiscard]] constexpr friend iterator operator-(const iterator & x,
+                                                          difference_type n) {
+            iterator tmp = x;
+            return tmp -= n;
+        }
+
+        [[nodiscard]] reference operator*() const noexcept {
+            return reference(static_cast<key_type>(_index),
+                             (_p[_index / N].load(std::memory_order_relaxed) &
+                              mask_of(_index)) != 0);
+        }
+        [[nodiscard]] reference operator[](difference_type i) const {
+            return *(*this + i);
+        }
+    };
+    using const_iterator = iterator;
+
+private:
+    std::unique_ptr<std::atomic<span_type>[]> _data;
+    size_type _size;
+
+public:
+    [[nodiscard]] static_map() noexcept : _data(nullptr), _size(0) {}
+    [[nodiscard]] explicit static_map(const size_type size)
+        : _data(std::make_unique<std::atomic<span_type>[]>(nb_spans(size)))
+        , _size(size) {}
+    [[nodiscard]] static_map(const size_type size, const bool init_value)
+        : static_map(size) {
+        fill(init_value);
+    }
+
+    [[nodiscard]] static_map(const static_map & other)
+        : static_map(other._size) {
+        copy_spans(other);
+    }
+    [[nodiscard]] static_map(static_map &&) = default;
+
+    static_map & operator=(const static_map & other) {
+        resize(other.size());
+        copy_spans(other);
+        return *this;
+    }
+    static_map & operator=(static_map &&) = default;
+
+private:
+    void copy_spans(const static_map & other) noexcept {
+        for(size_type i = 0; i < nb_spans(_size); ++i)
+            _data[i].store(other._data[i].load(std::memory_order_relaxed),
+                           std::memory_order_relaxed);
+    }
+
+public:
+    [[nodiscard]] iterator begin() const noexcept {
+        return iterator(_data.get(), 0);
+    }
+    [[nodiscard]] iterator end() const noexcept {
+        return iterator(_data.get(), _size);
+    }
+
+    [[nodiscard]] size_type size() const noexcept { return _size; }
+    void resize(const size_type n) {
+        if(n == size()) return;
+        _data = std::make_unique<std::atomic<span_type>[]>(nb_spans(n));
+        _size = n;
+    }
+
+    [[nodiscard]] reference operator[](const key_type k) noexcept {
+        const auto i = static_cast<size_type>(k);
+        assert(i < size());
+        return reference(_data.get() + i / N, i);
+    }
+    [[nodiscard]] const_reference operator[](
+        const key_type k) const noexcept {
+        const auto i = static_cast<size_type>(k);
+        assert(i < size());
+        return (_data[i / N].load(std::memory_order_relaxed) & mask_of(i)) !=
+               0;
+    }
+
+    // Sets k to true and returns its previous value.
+    bool test_and_set(const key_type k) noexcept {
+        const auto i = static_cast<size_type>(k);
+        assert(i < size());
+        const span_type mask = mask_of(i);
+        // a plain load avoids writing the shared word when k is already set
+        if(_data[i / N].load(std::memory_order_relaxed) & mask) return true;
+        return (_data[i / N].fetch_or(mask, std::memory_order_relaxed) &
+                mask) != 0;
+    }
+
+    // Not thread safe.
+    void fill(const bool b) noexcept {
+        const span_type value = b ? ~span_type(0) : span_type(0);
+        for(size_type i = 0; i < nb_spans(_size); ++i)
+            _data[i].store(value, std::memory_order_relaxed);
+    }
+};
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_STATIC_MAP_ATOMIC_BOOL_HPP
@@ -0,0 +1,78 @@
+#ifndef MELON_TOUCHED_MAP_HPP
+#define MELON_TOUCHED_MAP_HPP
+
+#include <cassert>
+#include <concepts>
+#include <vector>
+
+#include "melon/container/static_map.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Map recording the keys accessed through non const lookups since the last
+// fill(), which then only restores these keys when the fill value is the
+// previous one, in O(touched) time. Unlike epoch_map, reads are plain array
+// reads, but each touched key costs one more entry in the touched list.
+template <std::integral K, typename V>
+class touched_map {
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using size_type = std::size_t;
+
+private:
+    static_map<K, V> _values;
+    static_map<K, bool> _touched;
+    std::vector<K> _touched_keys;
+    V _fill_value;
+
+public:
+    [[nodiscard]] constexpr touched_map()
+        : _values(), _touched(), _touched_keys(), _fill_value() {}
+    [[nodiscard]] constexpr explicit touched_map(const size_type size,
+                                                 const V & fill_value = V())
+        : _values(size, fill_value)
+        , _touched(size, false)
+        , _touched_keys()
+        , _fill_value(fill_value) {}
+
+    [[nodiscard]] constexpr touched_map(const touched_map &) = default;
+    [[nodiscard]] constexpr touched_map(touched_map &&) = default;
+    touched_map & operator=(const touched_map &) = default;
+    touched_map & operator=(touched_map &&) = default;
+
+    [[nodiscard]] constexpr size_type size() const noexcept {
+        return _values.size();
+    }
+
+    [[nodiscard]] constexpr V & operator[](const K k) noexcept {
+        if(!_touched[k]) {
+            _touched[k] = true;
+            _touched_keys.push_back(k);
+        }
+        return _values[k];
+    }
+    [[nodiscard]] constexpr const V & operator[](const K k) const noexcept {
+        return _values[k];
+    }
+
+    constexpr void fill(const V & v) noexcept {
+        if(v == _fill_value) {
+            for(auto && k : _touched_keys) {
+                _values[k] = v;
+                _touched[k] = false;
+            }
+        } else {
+            _values.fill(v);
+            _touched.fill(false);
+            _fill_value = v;
+        }
+        _touched_keys.resize(0);
+    }
+};
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_TOUCHED_MAP_HPP
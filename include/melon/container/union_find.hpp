@@ -0,0 +1,99 @@
+#ifndef MELON_UNION_FIND_HPP
+#define MELON_UNION_FIND_HPP
+
+#include <cassert>
+#include <concepts>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace fhamonic {
+namespace melon {
+
+// Disjoint sets over the keys 0 to size()-1, e.g. the vertices of a graph.
+// find uses path halving and join links the root of the smaller set under
+// the root of the larger one, so that any sequence of m operations on n keys
+// takes O(m alpha(n)) time.
+template <std::unsigned_integral K = unsigned int>
+class union_find {
+public:
+    using key_type = K;
+    using component_type = K;
+    using size_type = std::size_t;
+
+private:
+    std::vector<key_type> _parents;
+    std::vector<key_type> _sizes;
+    size_type _nb_components;
+
+public:
+    [[nodiscard]] constexpr union_find() noexcept
+        : _parents(), _sizes(), _nb_components(0) {}
+    [[nodiscard]] constexpr explicit union_find(const size_type & nb_keys)
+        : _parents(nb_keys), _sizes(nb_keys, 1), _nb_components(nb_keys) {
+        std::iota(_parents.begin(), _parents.end(), key_type{0});
+    }
+
+    [[nodiscard]] constexpr union_find(const union_find & bin) = default;
+    [[nodiscard]] constexpr union_find(union_find && bin) = default;
+
+    union_find & operator=(const union_find &) = default;
+    union_find & operator=(union_find &&) = default;
+
+    [[nodiscard]] constexpr size_type size() const noexcept {
+        return _parents.size();
+    }
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        return _parents.empty();
+    }
+    [[nodiscard]] constexpr size_type nb_components() const noexcept {
+        return _nb_components;
+    }
+    constexpr void clear() noexcept {
+        _parents.resize(0);
+        _sizes.resize(0);
+        _nb_components = 0;
+    }
+
+    // Adds the key size() in its own set and returns it.
+    constexpr key_type push() noexcept {
+        const key_type k = static_cast<key_type>(_parents.size());
+        _parents.push_back(k);
+        _sizes.push_back(1);
+        ++_nb_components;
+        return k;
+    }
+    [[nodiscard]] constexpr component_type find(key_type k) noexcept {
+        assert(k < size());
+        while(_parents[k] != k) {
+            _parents[k] = _parents[_parents[k]];
+            k = _parents[k];
+        }
+        return k;
+    }
+    [[nodiscard]] constexpr bool connected(const key_type & k1,
+                                           const key_type & k2) noexcept {
+        return find(k1) == find(k2);
+    }
+    [[nodiscard]] constexpr size_type component_size(
+        const key_type & k) noexcept {
+        return _sizes[find(k)];
+    }
+    // Merges the sets of k1 and k2 and returns the root of the union.
+    constexpr component_type join(const key_type & k1,
+                                  const key_type & k2) noexcept {
+        component_type r1 = find(k1);
+        component_type r2 = find(k2);
+        if(r1 == r2) return r1;
+        if(_sizes[r1] < _sizes[r2]) std::swap(r1, r2);
+        _parents[r2] = r1;
+        _sizes[r1] += _sizes[r2];
+        --_nb_components;
+        return r1;
+    }
+};  // class union_find
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_UNION_FIND_HPP
@@ -0,0 +1,45 @@
+#ifndef MELON_DETAIL_ALIGNED_ALLOCATOR_HPP
+#define MELON_DETAIL_ALIGNED_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <new>
+
+namespace fhamonic {
+namespace melon {
+namespace __detail {
+
+// Allocator returning storage aligned on A bytes, e.g. on cache lines.
+template <typename T, std::size_t A>
+struct aligned_allocator {
+    static_assert(A >= alignof(T) && (A & (A - 1)) == 0);
+
+    using value_type = T;
+    template <typename U>
+    struct rebind {
+        using other = aligned_allocator<U, A>;
+    };
+
+    constexpr aligned_allocator() noexcept = default;
+    template <typename U>
+    constexpr aligned_allocator(const aligned_allocator<U, A> &) noexcept {}
+
+    [[nodiscard]] T * allocate(const std::size_t n) {
+        return static_cast<T *>(
+            ::operator new(n * sizeof(T), std::align_val_t{A}));
+    }
+    void deallocate(T * p, const std::size_t) noexcept {
+        ::operator delete(p, std::align_val_t{A});
+    }
+
+    template <typename U>
+    [[nodiscard]] constexpr bool operator==(
+        const aligned_allocator<U, A> &) const noexcept {
+        return true;
+    }
+};
+
+}  // namespace __detail
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_DETAIL_ALIGNED_ALLOCATOR_HPP
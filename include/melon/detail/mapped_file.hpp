@@ -0,0 +1,88 @@
+#ifndef MELON_DETAIL_MAPPED_FILE_HPP
+#define MELON_DETAIL_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace fhamonic {
+namespace melon {
+namespace __detail {
+
+// Read-only, shared memory mapping of a whole file.
+// Pages are loaded on first access and shared through the page cache between
+// every process mapping the same file.
+class mapped_file {
+private:
+    void * _address;
+    std::size_t _size;
+
+public:
+    [[nodiscard]] mapped_file() noexcept : _address(nullptr), _size(0) {}
+    [[nodiscard]] explicit mapped_file(const std::filesystem::path & path)
+        : mapped_file() {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if(fd < 0)
+            throw std::runtime_error("Cannot open '" + path.string() + "'.");
+        struct ::stat file_stat;
+        if(::fstat(fd, &file_stat) < 0) {
+            ::close(fd);
+            throw std::runtime_error("Cannot stat '" + path.string() + "'.");
+        }
+        _size = static_cast<std::size_t>(file_stat.st_size);
+        if(_size > 0) {
+            _address = ::mmap(nullptr, _size, PROT_READ, MAP_SHARED, fd, 0);
+            if(_address == MAP_FAILED) {
+                _address = nullptr;
+                _size = 0;
+                ::close(fd);
+                throw std::runtime_error("Cannot mmap '" + path.string() +
+                                         "'.");
+            }
+        }
+        ::close(fd);
+    }
+
+    mapped_file(const mapped_file &) = delete;
+    [[nodiscard]] mapped_file(mapped_file && other) noexcept
+        : _address(std::exchange(other._address, nullptr))
+        , _size(std::exchange(other._size, 0)) {}
+
+    mapped_file & operator=(const mapped_file &) = delete;
+    mapped_file & operator=(mapped_file && other) noexcept {
+        std::swap(_address, other._address);
+        std::swap(_size, other._size);
+        return *this;
+    }
+
+    ~mapped_file() {
+        if(_address != nullptr) ::munmap(_address, _size);
+    }
+
+    [[nodiscard]] const std::byte * data() const noexcept {
+        return static_cast<const std::byte *>(_address);
+    }
+    [[nodiscard]] std::size_t size() const noexcept { return _size; }
+    [[nodiscard]] std::span<const std::byte> bytes() const noexcept {
+        return std::span<const std::byte>(data(), _size);
+    }
+
+    // Hints the kernel about the expected access pattern of the mapping
+    void advise(int advice) const noexcept {
+        if(_address != nullptr) ::madvise(_address, _size, advice);
+    }
+};
+
+}  // namespace __detail
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_DETAIL_MAPPED_FILE_HPP
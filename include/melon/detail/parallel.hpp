@@ -0,0 +1,130 @@
+#ifndef MELON_DETAIL_PARALLEL_HPP
+#define MELON_DETAIL_PARALLEL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+namespace fhamonic {
+namespace melon {
+
+// Selects the multithreaded overload of a construction or an algorithm.
+// nb_threads == 0 means one thread per hardware thread.
+struct parallel_policy {
+    std::size_t nb_threads = 0;
+
+    [[nodiscard]] std::size_t thread_count() const noexcept {
+        if(nb_threads > 0) return nb_threads;
+        return std::max(std::size_t{1},
+                        static_cast<std::size_t>(
+                            std::thread::hardware_concurrency()));
+    }
+};
+
+inline constexpr parallel_policy par{};
+
+namespace __detail {
+
+// Splits [0, n) into at most policy.thread_count() contiguous blocks and calls
+// f(block_index, begin, end) on each of them in its own thread, the first
+// block being processed by the calling thread. Returns the number of blocks.
+// An exception thrown by f is rethrown once every thread has finished.
+template <typename F>
+std::size_t parallel_for_blocks(const parallel_policy & policy,
+                                const std::size_t n, F && f) {
+    const std::size_t nb_blocks = std::max(
+        std::size_t{1}, std::min(policy.thread_count(), n));
+    const std::size_t block_size = n / nb_blocks;
+    const std::size_t remainder = n % nb_blocks;
+    auto block_begin = [=](const std::size_t i) {
+        return i * block_size + std::min(i, remainder);
+    };
+    std::vector<std::exception_ptr> exceptions(nb_blocks);
+    auto run_block = [&](const std::size_t i) {
+        try {
+            f(i, block_begin(i), block_begin(i + 1));
+        } catch(...) {
+            exceptions[i] = std::current_exception();
+        }
+    };
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(nb_blocks - 1);
+        for(std::size_t i = 1; i < nb_blocks; ++i)
+            threads.emplace_back(run_block, i);
+        run_block(0);
+    }
+    for(auto && exception : exceptions)
+        if(exception) std::rethrow_exception(exception);
+    return nb_blocks;
+}
+
+// Calls f(i) for every i in [0, n), spread over the threads of the policy.
+template <typename F>
+void parallel_for(const parallel_policy & policy, const std::size_t n,
+                  F && f) {
+    parallel_for_blocks(policy, n,
+                        [&f](std::size_t, std::size_t begin, std::size_t end) {
+                            for(std::size_t i = begin; i < end; ++i) f(i);
+                        });
+}
+
+// Two pass blocked exclusive scan : each block is summed, the block sums are
+// scanned and each block is then scanned from its offset. The output may
+// alias the input. Returns the sum of the whole range.
+template <typename T>
+T parallel_exclusive_scan(const parallel_policy & policy, const T * first,
+                          const std::size_t n, T * out, const T init) {
+    std::vector<T> block_offsets(policy.thread_count() + 1, T{0});
+    const std::size_t nb_blocks = parallel_for_blocks(
+        policy, n,
+        [&](std::size_t block, std::size_t begin, std::size_t end) {
+            block_offsets[block + 1] =
+                std::accumulate(first + begin, first + end, T{0});
+        });
+    block_offsets[0] = init;
+    std::inclusive_scan(block_offsets.begin(),
+                        block_offsets.begin() +
+                            static_cast<std::ptrdiff_t>(nb_blocks + 1),
+                        block_offsets.begin());
+    parallel_for_blocks(
+        policy, n, [&](std::size_t block, std::size_t begin, std::size_t end) {
+            std::exclusive_scan(first + begin, first + end, out + begin,
+                                block_offsets[block]);
+        });
+    return block_offsets[nb_blocks];
+}
+
+// Fills the CSR begin offsets of n keys from the m sorted keys of a range,
+// i.e. begins[u] is the index of the first key greater or equal to u.
+template <std::random_access_iterator K, typename I>
+void parallel_sorted_keys_begins(const parallel_policy & policy,
+                                 const K keys, const std::size_t m,
+                                 I * begins, const std::size_t n) {
+    auto key_at = [keys](const std::size_t i) {
+        return static_cast<std::size_t>(keys[static_cast<std::ptrdiff_t>(i)]);
+    };
+    parallel_for_blocks(
+        policy, m, [&](std::size_t, std::size_t begin, std::size_t end) {
+            for(std::size_t i = begin; i < end; ++i) {
+                const std::size_t key = key_at(i);
+                for(std::size_t u = (i == 0 ? 0 : key_at(i - 1) + 1); u <= key;
+                    ++u)
+                    begins[u] = static_cast<I>(i);
+            }
+        });
+    const std::size_t first_empty = (m == 0 ? 0 : key_at(m - 1) + 1);
+    parallel_for(policy, n - first_empty, [&](std::size_t i) {
+        begins[first_empty + i] = static_cast<I>(m);
+    });
+}
+
+}  // namespace __detail
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_DETAIL_PARALLEL_HPP
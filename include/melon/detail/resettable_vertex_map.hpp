@@ -0,0 +1,47 @@
+#ifndef MELON_DETAIL_RESETTABLE_VERTEX_MAP_HPP
+#define MELON_DETAIL_RESETTABLE_VERTEX_MAP_HPP
+
+#include <type_traits>
+
+#include "melon/graph.hpp"
+
+namespace fhamonic {
+namespace melon {
+namespace __detail {
+
+// Traits of the traversal algorithms can declare
+//   template <typename K, typename V>
+//   using resettable_vertex_map = epoch_map<K, V>;
+// to choose the type of the vertex maps that are filled at each reset, e.g.
+// epoch_map or touched_map whose fill() does not cost O(n).
+template <typename T, typename G, typename V>
+struct resettable_vertex_map {
+    using type = vertex_map_t<G, V>;
+};
+
+template <typename T, typename G, typename V>
+    requires requires {
+                 typename T::template resettable_vertex_map<vertex_t<G>, V>;
+             }
+struct resettable_vertex_map<T, G, V> {
+    using type = typename T::template resettable_vertex_map<vertex_t<G>, V>;
+};
+
+template <typename T, typename G, typename V>
+using resettable_vertex_map_t = typename resettable_vertex_map<T, G, V>::type;
+
+template <typename T, typename V, typename G>
+[[nodiscard]] constexpr resettable_vertex_map_t<T, G, V>
+create_resettable_vertex_map(const G & g, const V & default_value) {
+    if constexpr(std::same_as<resettable_vertex_map_t<T, G, V>,
+                              vertex_map_t<G, V>>)
+        return create_vertex_map<V>(g, default_value);
+    else
+        return resettable_vertex_map_t<T, G, V>(nb_vertices(g), default_value);
+}
+
+}  // namespace __detail
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_DETAIL_RESETTABLE_VERTEX_MAP_HPP
@@ -0,0 +1,180 @@
+#ifndef MELON_DETAIL_SIMD_MINIMUM_HPP
+#define MELON_DETAIL_SIMD_MINIMUM_HPP
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#if defined(__SSE4_1__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace fhamonic {
+namespace melon {
+namespace __detail {
+
+// Position of the first minimum, for the order C, of N contiguous values with
+// SSE4.1 or AVX2 compares. The values are reduced to their minimum with
+// vertical then in-register min (or max for std::greater) instructions and
+// the position is read from the mask of the lanes equal to it. Since min and
+// max return one of their operands, the lanes are compared bitwise for every
+// value type. Only available for std::less and std::greater on 32 bit
+// integers, floats and doubles filling whole registers, 64 bit integers
+// having no min instruction before AVX-512.
+
+template <typename P>
+concept simd_value = std::same_as<P, std::int32_t> ||
+                     std::same_as<P, std::uint32_t> ||
+                     std::same_as<P, float> || std::same_as<P, double>;
+
+template <typename C, typename P>
+inline constexpr bool simd_is_less =
+    std::same_as<C, std::less<P>> || std::same_as<C, std::less<>>;
+template <typename C, typename P>
+inline constexpr bool simd_is_greater =
+    std::same_as<C, std::greater<P>> || std::same_as<C, std::greater<>>;
+
+#if defined(__SSE4_1__)
+struct sse_registers {
+    using type = __m128i;
+    static constexpr std::size_t size = 16;
+
+    static type load(const void * p) noexcept {
+        return _mm_loadu_si128(static_cast<const __m128i *>(p));
+    }
+    template <typename P, bool Max>
+    static type select(const type a, const type b) noexcept {
+        if constexpr(std::same_as<P, float>) {
+            const __m128 fa = _mm_castsi128_ps(a), fb = _mm_castsi128_ps(b);
+            return _mm_castps_si128(Max ? _mm_max_ps(fa, fb)
+                                        : _mm_min_ps(fa, fb));
+        } else if constexpr(std::same_as<P, double>) {
+            const __m128d da = _mm_castsi128_pd(a), db = _mm_castsi128_pd(b);
+            return _mm_castpd_si128(Max ? _mm_max_pd(da, db)
+                                        : _mm_min_pd(da, db));
+        } else if constexpr(std::same_as<P, std::int32_t>)
+            return Max ? _mm_max_epi32(a, b) : _mm_min_epi32(a, b);
+        else
+            return Max ? _mm_max_epu32(a, b) : _mm_min_epu32(a, b);
+    }
+    // broadcasts the minimum lane of v to every lane
+    template <typename P, bool Max>
+    static type reduce(type v) noexcept {
+        v = select<P, Max>(v, _mm_shuffle_epi32(v, 0x4E));
+        if constexpr(sizeof(P) == 4)
+            v = select<P, Max>(v, _mm_shuffle_epi32(v, 0xB1));
+        return v;
+    }
+    template <typename P>
+    static unsigned equal_lanes(const type a, const type b) noexcept {
+        if constexpr(sizeof(P) == 4)
+            return static_cast<unsigned>(
+                _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))));
+        else
+            return static_cast<unsigned>(
+                _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64(a, b))));
+    }
+};
+#endif
+
+#if defined(__AVX2__)
+struct avx2_registers {
+    using type = __m256i;
+    static constexpr std::size_t size = 32;
+
+    static type load(const void * p) noexcept {
+        return _mm256_loadu_si256(static_cast<const __m256i *>(p));
+    }
+    template <typename P, bool Max>
+    static type select(const type a, const type b) noexcept {
+        if constexpr(std::same_as<P, float>) {
+            const __m256 fa = _mm256_castsi256_ps(a),
+                         fb = _mm256_castsi256_ps(b);
+            return _mm256_castps_si256(Max ? _mm256_max_ps(fa, fb)
+                                           : _mm256_min_ps(fa, fb));
+        } else if constexpr(std::same_as<P, double>) {
+            const __m256d da = _mm256_castsi256_pd(a),
+                          db = _mm256_castsi256_pd(b);
+            return _mm256_castpd_si256(Max ? _mm256_max_pd(da, db)
+                                           : _mm256_min_pd(da, db));
+        } else if constexpr(std::same_as<P, std::int32_t>)
+            return Max ? _mm256_max_epi32(a, b) : _mm256_min_epi32(a, b);
+        else
+            return Max ? _mm256_max_epu32(a, b) : _mm256_min_epu32(a, b);
+    }
+    template <typename P, bool Max>
+    static type reduce(type v) noexcept {
+        v = select<P, Max>(v, _mm256_permute2x128_si256(v, v, 0x01));
+        v = select<P, Max>(v, _mm256_shuffle_epi32(v, 0x4E));
+        if constexpr(sizeof(P) == 4)
+            v = select<P, Max>(v, _mm256_shuffle_epi32(v, 0xB1));
+        return v;
+    }
+    template <typename P>
+    static unsigned equal_lanes(const type a, const type b) noexcept {
+        if constexpr(sizeof(P) == 4)
+            return static_cast<unsigned>(_mm256_movemask_ps(
+                _mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))));
+        else
+            return static_cast<unsigned>(_mm256_movemask_pd(
+                _mm256_castsi256_pd(_mm256_cmpeq_epi64(a, b))));
+    }
+};
+#endif
+
+template <typename R, std::size_t N, typename P, bool Max>
+[[nodiscard]] std::size_t simd_minimum_index_impl(const P * values) noexcept {
+    constexpr std::size_t lanes = R::size / sizeof(P);
+    constexpr std::size_t nb_registers = N / lanes;
+    typename R::type minimum = R::load(values);
+    for(std::size_t i = 1; i < nb_registers; ++i)
+        minimum = R::template select<P, Max>(minimum,
+                                             R::load(values + i * lanes));
+    minimum = R::template reduce<P, Max>(minimum);
+    for(std::size_t i = 0;; ++i) {
+        const unsigned mask = R::template equal_lanes<P>(
+            R::load(values + i * lanes), minimum);
+        if(mask)
+            return i * lanes +
+                   static_cast<std::size_t>(std::countr_zero(mask));
+    }
+}
+
+// AVX2 implies SSE4.1, whose registers are used when the values do not fill
+// whole AVX2 registers. simd_minimum_index falls back to a scalar scan
+// otherwise.
+template <std::size_t N, typename P, typename C>
+inline constexpr bool has_simd_minimum_index =
+#if defined(__SSE4_1__)
+    simd_value<P> && (simd_is_less<C, P> || simd_is_greater<C, P>) &&
+    (N * sizeof(P)) % 16 == 0;
+#else
+    false;
+#endif
+
+template <std::size_t N, typename C, typename P>
+[[nodiscard]] std::size_t simd_minimum_index(const P * values) noexcept {
+    if constexpr(has_simd_minimum_index<N, P, C>) {
+#if defined(__AVX2__)
+        if constexpr((N * sizeof(P)) % 32 == 0)
+            return simd_minimum_index_impl<avx2_registers, N, P,
+                                           simd_is_greater<C, P>>(values);
+#endif
+#if defined(__SSE4_1__)
+        return simd_minimum_index_impl<sse_registers, N, P,
+                                       simd_is_greater<C, P>>(values);
+#endif
+    }
+    std::size_t minimum = 0;
+    for(std::size_t i = 1; i < N; ++i)
+        if(C{}(values[i], values[minimum])) minimum = i;
+    return minimum;
+}
+
+}  // namespace __detail
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_DETAIL_SIMD_MINIMUM_HPP
@@ -865,6 +865,20 @@ concept inward_adjacency_graph =
                       melon::in_neighbors(__t, __v);
                   };
 
+// Graphs storing the (target, length) pairs of their out arcs contiguously,
+// which algorithms can scan in place of out_arcs when given their own length
+// map of type _LengthMap.
+template <typename _Tp, typename _LengthMap>
+concept outward_weighted_adjacency_graph =
+    outward_incidence_graph<_Tp> &&
+    std::same_as<std::remove_cvref_t<_LengthMap>,
+                 typename _Tp::arc_weights_map_type> &&
+    requires(const _Tp & __t, const vertex_t<_Tp> & __v) {
+        {
+            __t.out_weighted_neighbors(__v)
+            } -> std::ranges::contiguous_range;
+    };
+
 namespace __cust_access {
 template <typename _Tp>
 concept __member_create_vertex =
@@ -0,0 +1,125 @@
+#ifndef MELON_UTILITY_BATCH_QUERY_EXECUTOR_HPP
+#define MELON_UTILITY_BATCH_QUERY_EXECUTOR_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <concepts>
+#include <functional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "melon/detail/parallel.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+struct batch_statistics {
+    std::size_t nb_queries = 0;
+    std::chrono::duration<double> duration{0};
+
+    [[nodiscard]] double queries_per_second() const noexcept {
+        if(duration.count() <= 0) return 0;
+        return static_cast<double>(nb_queries) / duration.count();
+    }
+};
+
+// Answers batches of queries on the threads of a parallel_policy, each thread
+// owning one workspace, typically an algorithm instance on a shared read-only
+// graph, that is created once and reused by all the queries of all the
+// batches it processes. The queries are split in one range per thread and a
+// thread that has exhausted its range steals chunks from the others.
+template <typename W>
+class batch_query_executor {
+public:
+    using workspace = W;
+
+private:
+    static constexpr std::size_t chunk_size = 16;
+
+    struct alignas(64) range_cursor {
+        std::atomic<std::size_t> next;
+        std::size_t end;
+    };
+
+    parallel_policy _policy;
+    std::vector<workspace> _workspaces;
+
+public:
+    template <std::invocable F>
+        requires std::same_as<std::invoke_result_t<F &>, W>
+    [[nodiscard]] explicit batch_query_executor(
+        F && make_workspace, const parallel_policy & policy = par)
+        : _policy(policy) {
+        const std::size_t nb_threads = policy.thread_count();
+        _workspaces.reserve(nb_threads);
+        for(std::size_t t = 0; t < nb_threads; ++t)
+            _workspaces.emplace_back(make_workspace());
+    }
+
+    [[nodiscard]] std::size_t nb_threads() const noexcept {
+        return _workspaces.size();
+    }
+    [[nodiscard]] workspace & get_workspace(const std::size_t t) noexcept {
+        assert(t < nb_threads());
+        return _workspaces[t];
+    }
+
+    // Writes solve(w, queries[i]) in results[i] for every i, w being the
+    // workspace of the calling thread.
+    template <typename Q, typename R, typename S>
+        requires std::invocable<S &, workspace &, const Q &> &&
+                 std::assignable_from<
+                     R &, std::invoke_result_t<S &, workspace &, const Q &>>
+    batch_statistics run(std::span<const Q> queries, std::span<R> results,
+                         S && solve) {
+        assert(results.size() >= queries.size());
+        const auto start = std::chrono::steady_clock::now();
+        const std::size_t nb_blocks = std::max(
+            std::size_t{1}, std::min(nb_threads(), queries.size()));
+        std::vector<range_cursor> cursors(nb_blocks);
+        for(std::size_t b = 0; b < nb_blocks; ++b) {
+            cursors[b].next.store(b * queries.size() / nb_blocks,
+                                  std::memory_order_relaxed);
+            cursors[b].end = (b + 1) * queries.size() / nb_blocks;
+        }
+        __detail::parallel_for_blocks(
+            _policy, nb_blocks,
+            [&](const std::size_t t, std::size_t, std::size_t) {
+                workspace & w = _workspaces[t];
+                for(std::size_t k = 0; k < nb_blocks; ++k) {
+                    range_cursor & cursor = cursors[(t + k) % nb_blocks];
+                    for(;;) {
+                        const std::size_t begin = cursor.next.fetch_add(
+                            chunk_size, std::memory_order_relaxed);
+                        if(begin >= cursor.end) break;
+                        const std::size_t end =
+                            std::min(begin + chunk_size, cursor.end);
+                        for(std::size_t i = begin; i < end; ++i)
+                            results[i] = std::invoke(solve, w, queries[i]);
+                    }
+                }
+            });
+        return {queries.size(), std::chrono::steady_clock::now() - start};
+    }
+    template <typename Q, typename R, typename S>
+    batch_statistics run(const std::vector<Q> & queries,
+                         std::vector<R> & results, S && solve) {
+        return run(std::span<const Q>(queries), std::span<R>(results),
+                   std::forward<S>(solve));
+    }
+};
+
+template <typename F>
+batch_query_executor(F &&) -> batch_query_executor<std::invoke_result_t<F &>>;
+template <typename F>
+batch_query_executor(F &&, const parallel_policy &)
+    -> batch_query_executor<std::invoke_result_t<F &>>;
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_UTILITY_BATCH_QUERY_EXECUTOR_HPP
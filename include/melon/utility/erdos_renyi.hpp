@@ -10,8 +10,8 @@
 namespace fhamonic {
 namespace melon {
 
-static_digraph erdos_renyi(const std::size_t nb_vertices,
-                           const double expected_density) {
+inline static_digraph erdos_renyi(const std::size_t nb_vertices,
+                                  const double expected_density) {
     using vertex = vertex_t<static_digraph>;
 
     static std::uniform_real_distribution<double> distr{0.0, 1.0};
@@ -0,0 +1,350 @@
+#ifndef MELON_UTILITY_GRAPH_READERS_HPP
+#define MELON_UTILITY_GRAPH_READERS_HPP
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include <sys/mman.h>
+
+#include "melon/container/static_digraph.hpp"
+#include "melon/detail/mapped_file.hpp"
+#include "melon/detail/parallel.hpp"
+#include "melon/graph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+namespace fhamonic {
+namespace melon {
+namespace __detail {
+
+// Forward only scanner over the lines of a text chunk.
+class text_scanner {
+private:
+    const char * _p;
+    const char * _end;
+
+public:
+    [[nodiscard]] explicit text_scanner(const std::string_view text) noexcept
+        : _p(text.data()), _end(text.data() + text.size()) {}
+
+    [[nodiscard]] bool at_end() const noexcept { return _p == _end; }
+    [[nodiscard]] std::string_view remaining() const noexcept {
+        return std::string_view(_p, static_cast<std::size_t>(_end - _p));
+    }
+    [[nodiscard]] char peek() const noexcept { return *_p; }
+
+    void skip_blanks() noexcept {
+        while(_p != _end && (*_p == ' ' || *_p == '\t' || *_p == '\r')) ++_p;
+    }
+    [[nodiscard]] bool at_line_end() noexcept {
+        skip_blanks();
+        return _p == _end || *_p == '\n';
+    }
+    void skip_line() noexcept {
+        const void * eol =
+            std::memchr(_p, '\n', static_cast<std::size_t>(_end - _p));
+        _p = (eol == nullptr ? _end : static_cast<const char *>(eol) + 1);
+    }
+    void skip_token() {
+        if(at_line_end()) throw std::runtime_error("Unexpected end of line.");
+        while(_p != _end && *_p != ' ' && *_p != '\t' && *_p != '\r' &&
+              *_p != '\n')
+            ++_p;
+    }
+
+    // Throws if the value exceeds max_value.
+    [[nodiscard]] std::size_t read_unsigned(
+        const std::size_t max_value = std::numeric_limits<std::size_t>::max()) {
+        skip_blanks();
+        if(_p == _end || static_cast<unsigned char>(*_p - '0') > 9)
+            throw std::runtime_error("Expected an unsigned integer.");
+        std::size_t value = 0;
+        do {
+            const std::size_t digit = static_cast<std::size_t>(*_p - '0');
+            if(digit > max_value || value > (max_value - digit) / 10)
+                throw std::runtime_error("Unsigned integer out of range.");
+            value = value * 10 + digit;
+            ++_p;
+        } while(_p != _end && static_cast<unsigned char>(*_p - '0') <= 9);
+        return value;
+    }
+    template <typename T>
+    [[nodiscard]] T read_value() {
+        skip_blanks();
+        T value;
+        const auto [ptr, ec] = std::from_chars(_p, _end, value);
+        if(ec != std::errc()) throw std::runtime_error("Expected a number.");
+        _p = ptr;
+        return value;
+    }
+};
+
+// Splits the text in one chunk of whole lines per thread of the policy and
+// calls f(chunk_index, chunk) on each of them in parallel. A line belongs to
+// the chunk containing its first character. Returns the number of chunks.
+template <typename F>
+std::size_t parallel_for_line_chunks(const parallel_policy & policy,
+                                     const std::string_view text, F && f) {
+    auto line_begin = [text](const std::size_t i) -> std::size_t {
+        if(i == 0 || i >= text.size()) return std::min(i, text.size());
+        const std::size_t eol = text.find('\n', i - 1);
+        return (eol == std::string_view::npos ? text.size() : eol + 1);
+    };
+    return parallel_for_blocks(
+        policy, text.size(),
+        [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+            const std::size_t chunk_begin = line_begin(begin);
+            f(chunk, text.substr(chunk_begin, line_begin(end) - chunk_begin));
+        });
+}
+
+// Largest number of vertices of a graph with vertices of type V, such that
+// the vertex ids and their count are representable.
+template <typename V>
+inline constexpr std::size_t max_nb_vertices =
+    static_cast<std::size_t>(std::numeric_limits<V>::max());
+
+inline std::string_view file_text(const mapped_file & file) noexcept {
+    file.advise(MADV_SEQUENTIAL);
+    return std::string_view(reinterpret_cast<const char *>(file.data()),
+                            file.size());
+}
+
+// Arcs parsed from a chunk of a file, in file order.
+template <typename V, typename... W>
+struct parsed_arcs {
+    std::vector<V> sources;
+    std::vector<V> targets;
+    std::tuple<std::vector<W>...> weights;
+    std::size_t max_vertex_id = 0;
+
+    void read_weights(text_scanner & scanner) {
+        std::apply(
+            [&scanner](auto &... weights_column) {
+                (weights_column.push_back(
+                     scanner.template read_value<typename std::remove_cvref_t<
+                         decltype(weights_column)>::value_type>()),
+                 ...);
+            },
+            weights);
+    }
+};
+
+template <typename G, typename V, typename... W>
+static_digraph_builder<G, W...> make_builder(
+    const std::size_t nb_vertices,
+    std::vector<parsed_arcs<V, W...>> & chunks) {
+    static_digraph_builder<G, W...> builder(nb_vertices);
+    builder.reserve(std::transform_reduce(
+        chunks.begin(), chunks.end(), std::size_t{0}, std::plus<>(),
+        [](auto && chunk) { return chunk.sources.size(); }));
+    for(auto && chunk : chunks) {
+        std::apply(
+            [&](auto &&... weights_column) {
+                builder.add_arcs(chunk.sources, chunk.targets,
+                                 weights_column...);
+            },
+            chunk.weights);
+        chunk = parsed_arcs<V, W...>();
+    }
+    return builder;
+}
+
+}  // namespace __detail
+
+// Reads a DIMACS shortest path file (.gr) : "c" comment lines, one
+// "p sp <n> <m>" problem line and "a <u> <v> <w>" arc lines with vertices
+// numbered from 1. The arc weights are kept as arc property if W is given.
+template <graph G = static_digraph, typename... W>
+    requires(sizeof...(W) <= 1)
+[[nodiscard]] static_digraph_builder<G, W...> read_dimacs_gr(
+    const std::filesystem::path & path, const parallel_policy & policy = par) {
+    using vertex = vertex_t<G>;
+    __detail::mapped_file file(path);
+    const std::string_view text = __detail::file_text(file);
+    std::vector<__detail::parsed_arcs<vertex, W...>> chunks(
+        policy.thread_count());
+    std::vector<std::size_t> chunks_nb_vertices(policy.thread_count(), 0);
+
+    const std::size_t nb_chunks = __detail::parallel_for_line_chunks(
+        policy, text, [&](std::size_t i, std::string_view chunk_text) {
+            auto & chunk = chunks[i];
+            __detail::text_scanner scanner(chunk_text);
+            while(!scanner.at_end()) {
+                if(scanner.peek() == 'a') {
+                    scanner.skip_token();
+                    const std::size_t u = scanner.read_unsigned(
+                        __detail::max_nb_vertices<vertex>);
+                    const std::size_t v = scanner.read_unsigned(
+                        __detail::max_nb_vertices<vertex>);
+                    if(u == 0 || v == 0)
+                        throw std::runtime_error(
+                            "DIMACS vertices are numbered from 1.");
+                    chunk.sources.push_back(static_cast<vertex>(u - 1));
+                    chunk.targets.push_back(static_cast<vertex>(v - 1));
+                    chunk.max_vertex_id =
+                        std::max({chunk.max_vertex_id, u - 1, v - 1});
+                    if constexpr(sizeof...(W) > 0) chunk.read_weights(scanner);
+                } else if(scanner.peek() == 'p') {
+                    scanner.skip_token();
+                    scanner.skip_token();
+                    chunks_nb_vertices[i] = scanner.read_unsigned(
+                        __detail::max_nb_vertices<vertex>);
+                }
+                scanner.skip_line();
+            }
+        });
+    chunks.resize(nb_chunks);
+
+    const std::size_t nb_vertices = std::ranges::max(chunks_nb_vertices);
+    for(auto && chunk : chunks)
+        if(!chunk.sources.empty() && chunk.max_vertex_id >= nb_vertices)
+            throw std::runtime_error("Invalid vertex in DIMACS file '" +
+                                     path.string() + "'.");
+    return __detail::make_builder<G>(nb_vertices, chunks);
+}
+
+// Reads a SNAP edge list : "#" comment lines and "<u> <v> [<w>...]" arc lines
+// with vertices numbered from 0. The number of vertices is the largest vertex
+// id plus one. The columns following the endpoints are read as arc
+// properties of types W... .
+template <graph G = static_digraph, typename... W>
+[[nodiscard]] static_digraph_builder<G, W...> read_snap(
+    const std::filesystem::path & path, const parallel_policy & policy = par) {
+    using vertex = vertex_t<G>;
+    __detail::mapped_file file(path);
+    const std::string_view text = __detail::file_text(file);
+    std::vector<__detail::parsed_arcs<vertex, W...>> chunks(
+        policy.thread_count());
+
+    const std::size_t nb_chunks = __detail::parallel_for_line_chunks(
+        policy, text, [&](std::size_t i, std::string_view chunk_text) {
+            auto & chunk = chunks[i];
+            __detail::text_scanner scanner(chunk_text);
+            while(!scanner.at_end()) {
+                if(!scanner.at_line_end() && scanner.peek() != '#') {
+                    const std::size_t u = scanner.read_unsigned(
+                        __detail::max_nb_vertices<vertex> - 1);
+                    const std::size_t v = scanner.read_unsigned(
+                        __detail::max_nb_vertices<vertex> - 1);
+                    chunk.sources.push_back(static_cast<vertex>(u));
+                    chunk.targets.push_back(static_cast<vertex>(v));
+                    chunk.max_vertex_id =
+                        std::max({chunk.max_vertex_id, u, v});
+                    if constexpr(sizeof...(W) > 0) chunk.read_weights(scanner);
+                }
+                scanner.skip_line();
+            }
+        });
+    chunks.resize(nb_chunks);
+
+    std::size_t nb_vertices = 0;
+    for(auto && chunk : chunks)
+        if(!chunk.sources.empty())
+            nb_vertices = std::max(nb_vertices, chunk.max_vertex_id + 1);
+    return __detail::make_builder<G>(nb_vertices, chunks);
+}
+
+// Reads a METIS graph file : "%" comment lines, a "<n> <m> [fmt [ncon]]"
+// header and then the i-th line lists the neighbors of vertex i, numbered
+// from 1. Each edge is listed by both of its endpoints and thus gives two
+// opposite arcs. Vertex sizes and weights are skipped and edge weights are
+// kept as arc property if W is given, defaulting to 1 if the file has none.
+template <graph G = static_digraph, typename... W>
+    requires(sizeof...(W) <= 1)
+[[nodiscard]] static_digraph_builder<G, W...> read_metis(
+    const std::filesystem::path & path, const parallel_policy & policy = par) {
+    using vertex = vertex_t<G>;
+    __detail::mapped_file file(path);
+    std::string_view text = __detail::file_text(file);
+
+    __detail::text_scanner header_scanner(text);
+    while(!header_scanner.at_end() && header_scanner.peek() == '%')
+        header_scanner.skip_line();
+    const std::size_t nb_vertices =
+        header_scanner.read_unsigned(__detail::max_nb_vertices<vertex>);
+    const std::size_t nb_edges = header_scanner.read_unsigned(
+        std::numeric_limits<std::size_t>::max() / 2);
+    std::size_t format = 0;
+    std::size_t nb_constraints = 1;
+    if(!header_scanner.at_line_end()) {
+        format = header_scanner.read_unsigned();
+        if(!header_scanner.at_line_end())
+            nb_constraints = header_scanner.read_unsigned();
+    }
+    const bool has_edge_weights = format % 10 != 0;
+    const std::size_t nb_skipped_values =
+        (format / 100 % 10 != 0 ? 1 : 0) +
+        (format / 10 % 10 != 0 ? nb_constraints : 0);
+    header_scanner.skip_line();
+    text = header_scanner.remaining();
+
+    // vertex lines are counted per chunk to number the lines of each chunk
+    std::vector<std::size_t> chunks_first_vertex(policy.thread_count() + 1, 0);
+    __detail::parallel_for_line_chunks(
+        policy, text, [&](std::size_t i, std::string_view chunk_text) {
+            std::size_t nb_lines = 0;
+            for(__detail::text_scanner scanner(chunk_text); !scanner.at_end();
+                scanner.skip_line())
+                if(scanner.peek() != '%') ++nb_lines;
+            chunks_first_vertex[i + 1] = nb_lines;
+        });
+    std::inclusive_scan(chunks_first_vertex.begin(), chunks_first_vertex.end(),
+                        chunks_first_vertex.begin());
+
+    std::vector<__detail::parsed_arcs<vertex, W...>> chunks(
+        policy.thread_count());
+    const std::size_t nb_chunks = __detail::parallel_for_line_chunks(
+        policy, text, [&](std::size_t i, std::string_view chunk_text) {
+            auto & chunk = chunks[i];
+            std::size_t u = chunks_first_vertex[i];
+            for(__detail::text_scanner scanner(chunk_text); !scanner.at_end();
+                scanner.skip_line()) {
+                if(scanner.peek() == '%') continue;
+                if(u >= nb_vertices) {
+                    if(scanner.at_line_end()) continue;
+                    throw std::runtime_error("Too many vertex lines.");
+                }
+                for(std::size_t k = 0; k < nb_skipped_values; ++k)
+                    scanner.skip_token();
+                while(!scanner.at_line_end()) {
+                    const std::size_t v = scanner.read_unsigned(nb_vertices);
+                    if(v == 0)
+                        throw std::runtime_error("Invalid METIS vertex.");
+                    chunk.sources.push_back(static_cast<vertex>(u));
+                    chunk.targets.push_back(static_cast<vertex>(v - 1));
+                    if constexpr(sizeof...(W) > 0) {
+                        if(has_edge_weights)
+                            chunk.read_weights(scanner);
+                        else
+                            std::get<0>(chunk.weights).emplace_back(1);
+                    } else if(has_edge_weights) {
+                        scanner.skip_token();
+                    }
+                }
+                ++u;
+            }
+        });
+    chunks.resize(nb_chunks);
+
+    const std::size_t nb_arcs = std::transform_reduce(
+        chunks.begin(), chunks.end(), std::size_t{0}, std::plus<>(),
+        [](auto && chunk) { return chunk.sources.size(); });
+    if(nb_arcs != 2 * nb_edges)
+        throw std::runtime_error("Wrong number of edges in METIS file '" +
+                                 path.string() + "'.");
+    return __detail::make_builder<G>(nb_vertices, chunks);
+}
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_UTILITY_GRAPH_READERS_HPP
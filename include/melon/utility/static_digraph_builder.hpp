@@ -2,13 +2,16 @@
 #define MELON_STATIC_DIGRAPH_BUILDER_HPP
 
 #include <algorithm>
+#include <atomic>
+#include <cassert>
 #include <numeric>
 #include <ranges>
+#include <tuple>
+#include <utility>
 #include <vector>
 
-#include <range/v3/algorithm/sort.hpp>
-#include <range/v3/view/zip.hpp>
-
+#include "melon/container/static_map.hpp"
+#include "melon/detail/parallel.hpp"
 #include "melon/graph.hpp"
 
 namespace fhamonic {
@@ -50,19 +53,118 @@ public:
         return *this;
     }
 
-    auto build() {
-        auto arcs_zipped_view = std::apply(
-            [this](auto &&... property_map) {
-                return ranges::view::zip(_arc_sources, _arc_targets,
-                                         property_map...);
+private:
+    template <class Maps, class Properties, std::size_t... Is>
+    void append_properties(Maps && maps, Properties && properties,
+                           std::index_sequence<Is...>) {
+        (get<Is>(maps).insert(get<Is>(maps).end(),
+                              std::ranges::begin(get<Is>(properties)),
+                              std::ranges::end(get<Is>(properties))),
+         ...);
+    }
+
+public:
+    // Appends the arcs (sources[i], targets[i]) with their properties at once,
+    // e.g. from the per chunk buffers of a file reader.
+    template <std::ranges::forward_range S, std::ranges::forward_range T,
+              std::ranges::forward_range... P>
+        requires std::ranges::common_range<S> &&
+                 std::ranges::common_range<T> &&
+                 (std::ranges::common_range<P> && ...) &&
+                 (sizeof...(P) == sizeof...(ArcProperty))
+    static_digraph_builder & add_arcs(S && sources, T && targets,
+                                      P &&... properties) {
+        assert(std::ranges::distance(sources) ==
+               std::ranges::distance(targets));
+        assert(((std::ranges::distance(properties) ==
+                 std::ranges::distance(targets)) &&
+                ...));
+        assert(std::ranges::all_of(
+            sources, [n = _nb_vertices](auto && v) { return v < n; }));
+        assert(std::ranges::all_of(
+            targets, [n = _nb_vertices](auto && v) { return v < n; }));
+        _arc_sources.insert(_arc_sources.end(), std::ranges::begin(sources),
+                            std::ranges::end(sources));
+        _arc_targets.insert(_arc_targets.end(), std::ranges::begin(targets),
+                            std::ranges::end(targets));
+        append_properties(
+            _arc_property_maps, std::forward_as_tuple(properties...),
+            std::make_index_sequence<std::tuple_size<property_maps>{}>{});
+        return *this;
+    }
+
+    void reserve(const std::size_t nb_arcs) {
+        _arc_sources.reserve(nb_arcs);
+        _arc_targets.reserve(nb_arcs);
+        std::apply(
+            [nb_arcs](auto &&... property_map) {
+                (property_map.reserve(nb_arcs), ...);
             },
             _arc_property_maps);
-        ranges::sort(arcs_zipped_view, [](const auto & a, const auto & b) {
-            if(std::get<0>(a) == std::get<0>(b))
-                return std::get<1>(a) < std::get<1>(b);
-            return std::get<0>(a) < std::get<0>(b);
+    }
+
+    [[nodiscard]] std::size_t nb_vertices() const noexcept {
+        return _nb_vertices;
+    }
+    [[nodiscard]] std::size_t nb_arcs() const noexcept {
+        return _arc_sources.size();
+    }
+
+private:
+    // Stable counting sort of the arc indices of permutation by their key.
+    void counting_sort(std::vector<arc> & permutation,
+                       const std::vector<vertex> & keys) const {
+        std::vector<arc> bucket_begin(_nb_vertices + 1, arc{0});
+        for(auto && k : keys) ++bucket_begin[static_cast<std::size_t>(k) + 1];
+        std::inclusive_scan(bucket_begin.begin(), bucket_begin.end(),
+                            bucket_begin.begin());
+        std::vector<arc> sorted_permutation(permutation.size());
+        for(auto && a : permutation)
+            sorted_permutation[bucket_begin[keys[a]]++] = a;
+        permutation.swap(sorted_permutation);
+    }
+
+    template <typename T>
+    static void permute(std::vector<T> & values,
+                        const std::vector<arc> & permutation) {
+        std::vector<T> permuted_values;
+        permuted_values.reserve(values.size());
+        for(auto && a : permutation)
+            permuted_values.push_back(std::move(values[a]));
+        values.swap(permuted_values);
+    }
+
+    template <typename T>
+    static void permute(const parallel_policy & policy, std::vector<T> & values,
+                        const std::vector<arc> & permutation) {
+        std::vector<T> permuted_values(values.size());
+        __detail::parallel_for(policy, values.size(), [&](std::size_t i) {
+            permuted_values[i] = std::move(values[permutation[i]]);
         });
-        ;
+        values.swap(permuted_values);
+    }
+
+    void permute_arcs(const std::vector<arc> & permutation) {
+        permute(_arc_sources, permutation);
+        permute(_arc_targets, permutation);
+        std::apply(
+            [&](auto &&... property_map) {
+                (permute(property_map, permutation), ...);
+            },
+            _arc_property_maps);
+    }
+
+public:
+    // Sorts the arcs by (source, target) with two stable counting sorts, in
+    // O(n + m). Arcs with the same source and target keep their insertion
+    // order. If sort_targets is false, the out arcs of each vertex are left
+    // in insertion order.
+    auto build(const bool sort_targets = true) {
+        std::vector<arc> permutation(_arc_sources.size());
+        std::iota(permutation.begin(), permutation.end(), arc{0});
+        if(sort_targets) counting_sort(permutation, _arc_targets);
+        counting_sort(permutation, _arc_sources);
+        permute_arcs(permutation);
         return std::apply(
             [this](auto &&... property_map) {
                 return std::make_tuple(
@@ -71,6 +173,68 @@ public:
             },
             _arc_property_maps);
     }
+
+public:
+    // Multithreaded build : arcs are bucketed by source with a parallel
+    // counting sort and each bucket is then sorted by (target, insertion
+    // index), or by insertion index only if sort_targets is false. The result
+    // is the one of the serial build whatever the number of threads.
+    auto build(const parallel_policy & policy, const bool sort_targets = true) {
+        const std::size_t nb_arcs = _arc_sources.size();
+        static_map<vertex, arc> bucket_begin(_nb_vertices);
+        static_map<vertex, arc> bucket_cursor(_nb_vertices);
+        __detail::parallel_for(policy, _nb_vertices, [&](std::size_t u) {
+            bucket_cursor[static_cast<vertex>(u)] = 0;
+        });
+        __detail::parallel_for(policy, nb_arcs, [&](std::size_t i) {
+            std::atomic_ref<arc>(bucket_cursor[_arc_sources[i]])
+                .fetch_add(1, std::memory_order_relaxed);
+        });
+        __detail::parallel_exclusive_scan(policy, bucket_cursor.data(),
+                                          _nb_vertices, bucket_begin.data(),
+                                          arc{0});
+        __detail::parallel_for(policy, _nb_vertices, [&](std::size_t u) {
+            bucket_cursor[static_cast<vertex>(u)] =
+                bucket_begin[static_cast<vertex>(u)];
+        });
+        std::vector<arc> permutation(nb_arcs);
+        __detail::parallel_for(policy, nb_arcs, [&](std::size_t i) {
+            const arc position =
+                std::atomic_ref<arc>(bucket_cursor[_arc_sources[i]])
+                    .fetch_add(1, std::memory_order_relaxed);
+            permutation[position] = static_cast<arc>(i);
+        });
+        __detail::parallel_for(policy, _nb_vertices, [&](std::size_t u) {
+            std::sort(permutation.data() + bucket_begin[static_cast<vertex>(u)],
+                      permutation.data() + bucket_cursor[static_cast<vertex>(u)],
+                      [this, sort_targets](const arc & a, const arc & b) {
+                          if(!sort_targets || _arc_targets[a] == _arc_targets[b])
+                              return a < b;
+                          return _arc_targets[a] < _arc_targets[b];
+                      });
+        });
+        permute(policy, _arc_sources, permutation);
+        permute(policy, _arc_targets, permutation);
+        std::apply(
+            [&](auto &&... property_map) {
+                (permute(policy, property_map, permutation), ...);
+            },
+            _arc_property_maps);
+        return std::apply(
+            [&](auto &&... property_map) {
+                if constexpr(std::constructible_from<
+                                 G, const parallel_policy &, std::size_t,
+                                 std::vector<vertex> &, std::vector<vertex> &>)
+                    return std::make_tuple(
+                        G(policy, _nb_vertices, _arc_sources, _arc_targets),
+                        property_map...);
+                else
+                    return std::make_tuple(
+                        G(_nb_vertices, _arc_sources, _arc_targets),
+                        property_map...);
+            },
+            _arc_property_maps);
+    }
 };
 
 }  // namespace melon
@@ -46,7 +46,8 @@ concept contiguous_value_map =
     requires(M & __m) {
         {
             __m.data()
-            } -> std::same_as<std::add_pointer_t<mapped_value_t<M, K>>>;
+            } -> std::convertible_to<
+                std::add_pointer_t<std::add_const_t<mapped_value_t<M, K>>>>;
     };
 
 template <typename M, typename K, typename V>
@@ -0,0 +1,262 @@
+#ifndef MELON_UTILITY_VERTEX_REORDERING_HPP
+#define MELON_UTILITY_VERTEX_REORDERING_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "melon/container/static_digraph.hpp"
+#include "melon/container/static_map.hpp"
+#include "melon/graph.hpp"
+#include "melon/utility/value_map.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Vertex orders are returned as the sequence of the vertices in their new
+// order, i.e. the inverse permutation. Arcs are followed in both directions
+// when the graph provides in arcs, so that weakly connected vertices end up
+// close to each other.
+namespace __detail {
+template <typename G, typename F>
+constexpr void for_each_symmetric_neighbor(const G & g, const vertex_t<G> & u,
+                                           F && f) {
+    for(auto && w : melon::out_neighbors(g, u)) f(w);
+    if constexpr(inward_adjacency_graph<G>)
+        for(auto && w : melon::in_neighbors(g, u)) f(w);
+}
+
+template <typename G>
+constexpr std::size_t symmetric_degree(const G & g, const vertex_t<G> & u) {
+    std::size_t degree = 0;
+    for_each_symmetric_neighbor(g, u, [&degree](auto &&) { ++degree; });
+    return degree;
+}
+}  // namespace __detail
+
+template <outward_adjacency_graph G>
+    requires has_vertex_map<G>
+[[nodiscard]] std::vector<vertex_t<G>> bfs_order(const G & g) {
+    using vertex = vertex_t<G>;
+    std::vector<vertex> order;
+    order.reserve(melon::nb_vertices(g));
+    auto reached = create_vertex_map<bool>(g, false);
+    for(auto && s : melon::vertices(g)) {
+        if(reached[s]) continue;
+        reached[s] = true;
+        order.push_back(s);
+        for(std::size_t i = order.size() - 1; i < order.size(); ++i) {
+            __detail::for_each_symmetric_neighbor(
+                g, order[i], [&](const vertex & w) {
+                    if(reached[w]) return;
+                    reached[w] = true;
+                    order.push_back(w);
+                });
+        }
+    }
+    return order;
+}
+
+template <outward_adjacency_graph G>
+    requires has_vertex_map<G>
+[[nodiscard]] std::vector<vertex_t<G>> reverse_cuthill_mckee_order(
+    const G & g) {
+    using vertex = vertex_t<G>;
+    auto degree = create_vertex_map<std::size_t>(g);
+    for(auto && u : melon::vertices(g))
+        degree[u] = __detail::symmetric_degree(g, u);
+    // components are started from their minimum degree vertex, a cheap
+    // approximation of a peripheral vertex
+    std::vector<vertex> roots(melon::vertices(g).begin(),
+                              melon::vertices(g).end());
+    std::ranges::stable_sort(roots, {},
+                             [&degree](const vertex & u) { return degree[u]; });
+
+    std::vector<vertex> order;
+    order.reserve(melon::nb_vertices(g));
+    auto reached = create_vertex_map<bool>(g, false);
+    for(auto && s : roots) {
+        if(reached[s]) continue;
+        reached[s] = true;
+        order.push_back(s);
+        for(std::size_t i = order.size() - 1; i < order.size(); ++i) {
+            const std::size_t first_child = order.size();
+            __detail::for_each_symmetric_neighbor(
+                g, order[i], [&](const vertex & w) {
+                    if(reached[w]) return;
+                    reached[w] = true;
+                    order.push_back(w);
+                });
+            std::stable_sort(
+                order.begin() + static_cast<std::ptrdiff_t>(first_child),
+                order.end(), [&degree](const vertex & u, const vertex & v) {
+                    return degree[u] < degree[v];
+                });
+        }
+    }
+    std::ranges::reverse(order);
+    return order;
+}
+
+template <outward_adjacency_graph G>
+    requires has_vertex_map<G>
+[[nodiscard]] std::vector<vertex_t<G>> degree_order(const G & g) {
+    using vertex = vertex_t<G>;
+    auto degree = create_vertex_map<std::size_t>(g);
+    for(auto && u : melon::vertices(g))
+        degree[u] = __detail::symmetric_degree(g, u);
+    std::vector<vertex> order(melon::vertices(g).begin(),
+                              melon::vertices(g).end());
+    std::ranges::stable_sort(order, std::ranges::greater{},
+                             [&degree](const vertex & u) { return degree[u]; });
+    return order;
+}
+
+// Recursive bisection : each part is split in two halves along the BFS order
+// computed from an approximate peripheral vertex of the part, until parts
+// have at most max_part_size vertices. Parts are laid out consecutively so
+// that vertices of a same part share cache lines and pages.
+template <outward_adjacency_graph G>
+    requires has_vertex_map<G>
+[[nodiscard]] std::vector<vertex_t<G>> partition_order(
+    const G & g, const std::size_t max_part_size = 64) {
+    using vertex = vertex_t<G>;
+    assert(max_part_size > 0);
+    std::vector<vertex> order(melon::vertices(g).begin(),
+                              melon::vertices(g).end());
+    auto part = create_vertex_map<std::size_t>(g, 0);
+    auto visited = create_vertex_map<bool>(g, false);
+    std::size_t nb_parts = 1;
+    std::vector<vertex> queue;
+    queue.reserve(order.size());
+
+    // BFS restricted to the vertices of part p, starting from s
+    auto part_bfs = [&](const vertex & s, const std::size_t p) {
+        queue.clear();
+        queue.push_back(s);
+        visited[s] = true;
+        for(std::size_t i = 0; i < queue.size(); ++i) {
+            __detail::for_each_symmetric_neighbor(
+                g, queue[i], [&](const vertex & w) {
+                    if(visited[w] || part[w] != p) return;
+                    visited[w] = true;
+                    queue.push_back(w);
+                });
+        }
+        for(auto && u : queue) visited[u] = false;
+    };
+
+    // (begin, end, part) ranges of order to split, processed depth first
+    std::vector<std::tuple<std::size_t, std::size_t, std::size_t>> stack{
+        {0, order.size(), 0}};
+    while(!stack.empty()) {
+        const auto [begin, end, p] = stack.back();
+        stack.pop_back();
+        if(end - begin <= max_part_size) continue;
+
+        auto range = std::span(order).subspan(begin, end - begin);
+        std::size_t nb_sorted = 0;
+        while(nb_sorted < range.size()) {  // handles disconnected parts
+            part_bfs(range[nb_sorted], p);
+            part_bfs(queue.back(), p);  // from the farthest vertex found
+            for(auto && u : queue) visited[u] = true;
+            auto unvisited_begin = std::stable_partition(
+                range.begin() + static_cast<std::ptrdiff_t>(nb_sorted),
+                range.end(), [&visited](const vertex & u) {
+                    return visited[u];
+                });
+            std::copy(queue.begin(), queue.end(),
+                      range.begin() + static_cast<std::ptrdiff_t>(nb_sorted));
+            for(auto && u : queue) {
+                visited[u] = false;
+                part[u] = nb_parts;  // excluded from the next component BFS
+            }
+            nb_sorted = static_cast<std::size_t>(
+                std::distance(range.begin(), unvisited_begin));
+        }
+        const std::size_t middle = begin + (end - begin) / 2;
+        const std::size_t first_part = nb_parts++;
+        const std::size_t second_part = nb_parts++;
+        for(std::size_t i = begin; i < middle; ++i) part[order[i]] = first_part;
+        for(std::size_t i = middle; i < end; ++i) part[order[i]] = second_part;
+        stack.emplace_back(middle, end, second_part);
+        stack.emplace_back(begin, middle, first_part);
+    }
+    return order;
+}
+
+// A static_digraph renumbered according to a vertex order, with the maps
+// relating its vertices and arcs to the ones of the original graph.
+template <typename V, typename A>
+struct vertex_reordering {
+    basic_static_digraph<V, A> graph;
+    // new vertex of each original vertex
+    static_map<V, V> new_vertices;
+    // original vertex of each new vertex
+    static_map<V, V> old_vertices;
+    // original arc of each new arc
+    static_map<A, A> old_arcs;
+
+    template <input_value_map<V> M>
+    [[nodiscard]] auto permute_vertex_map(const M & map) const {
+        static_map<V, mapped_value_t<M, V>> permuted_map(old_vertices.size());
+        for(auto && u : graph.vertices()) permuted_map[u] = map[old_vertices[u]];
+        return permuted_map;
+    }
+    template <input_value_map<A> M>
+    [[nodiscard]] auto permute_arc_map(const M & map) const {
+        static_map<A, mapped_value_t<M, A>> permuted_map(old_arcs.size());
+        for(auto && a : graph.arcs()) permuted_map[a] = map[old_arcs[a]];
+        return permuted_map;
+    }
+};
+
+// Renumbers the vertices of g so that order[i] becomes vertex i. The out arcs
+// of each vertex are sorted by their new targets.
+template <typename V, typename A, std::ranges::forward_range O>
+    requires std::convertible_to<std::ranges::range_value_t<O>, V>
+[[nodiscard]] vertex_reordering<V, A> reorder_vertices(
+    const basic_static_digraph<V, A> & g, const O & order) {
+    assert(static_cast<std::size_t>(std::ranges::distance(order)) ==
+           g.nb_vertices());
+    const std::size_t n = g.nb_vertices();
+    const std::size_t m = g.nb_arcs();
+    static_map<V, V> new_vertices(n);
+    static_map<V, V> old_vertices(std::ranges::begin(order),
+                                  std::ranges::end(order));
+    for(auto && u : g.vertices()) new_vertices[old_vertices[u]] = u;
+    assert(std::ranges::all_of(g.vertices(), [&](const V & u) {
+        return old_vertices[new_vertices[u]] == u;
+    }));
+
+    std::vector<V> sources;
+    std::vector<V> targets;
+    std::vector<std::pair<V, A>> out_arcs;
+    static_map<A, A> old_arcs(m);
+    sources.reserve(m);
+    targets.reserve(m);
+    for(auto && u : g.vertices()) {
+        out_arcs.clear();
+        for(auto && a : g.out_arcs(old_vertices[u]))
+            out_arcs.emplace_back(new_vertices[g.arc_target(a)], a);
+        std::ranges::sort(out_arcs);
+        for(auto && [t, a] : out_arcs) {
+            old_arcs[static_cast<A>(targets.size())] = a;
+            sources.push_back(u);
+            targets.push_back(t);
+        }
+    }
+    return vertex_reordering<V, A>{
+        basic_static_digraph<V, A>(n, std::move(sources), std::move(targets)),
+        std::move(new_vertices), std::move(old_vertices), std::move(old_arcs)};
+}
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_UTILITY_VERTEX_REORDERING_HPP
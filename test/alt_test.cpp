@@ -0,0 +1,194 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "melon/algorithm/alt.hpp"
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+#include "random_grid_helper.hpp"
+#include "random_ranges_helper.hpp"
+
+using namespace fhamonic::melon;
+
+template <typename G, typename L>
+struct alt_reference_dijkstra_traits : public dijkstra_default_traits<G, L> {
+    static constexpr bool store_distances = true;
+};
+
+template <typename G, typename L>
+struct alt_target_dijkstra_traits : public dijkstra_default_traits<G, L> {
+    static constexpr bool stop_at_targets = true;
+};
+
+// ALT A* and bidirectional ALT settle strictly fewer vertices in total than
+// dijkstra stopped at the target, over all the queries
+template <typename G, typename L>
+void check_alt_settles_fewer(const G & graph, const L & length_map,
+                             const alt_landmarks<G, L> & landmarks) {
+    dijkstra<G, L, alt_target_dijkstra_traits<G, L>> alg(graph, length_map);
+    alt_dijkstra astar(graph, length_map, landmarks);
+    alt_bidirectional_dijkstra bidir(graph, length_map, landmarks);
+    std::size_t dijkstra_nb_settled = 0;
+    std::size_t astar_nb_settled = 0;
+    std::size_t bidir_nb_settled = 0;
+    for(auto && s : graph.vertices()) {
+        for(auto && t : graph.vertices()) {
+            if(s == t) continue;
+            alg.reset();
+            alg.add_source(s).add_target(t).run();
+            dijkstra_nb_settled += alg.nb_settled();
+
+            astar.reset();
+            astar.add_source(s).add_target(t).run();
+            astar_nb_settled += astar.nb_settled();
+
+            bidir.reset();
+            bidir.add_source(s).add_target(t).run();
+            bidir_nb_settled += bidir.nb_settled();
+        }
+    }
+    ASSERT_LT(astar_nb_settled, dijkstra_nb_settled);
+    ASSERT_LT(bidir_nb_settled, dijkstra_nb_settled);
+}
+
+template <typename G, typename L, typename Q>
+void check_alt_path(const G & graph, const L & length_map, const Q & query,
+                    const unsigned s, const unsigned t, const int st_dist) {
+    auto u = s;
+    int length = 0;
+    for(auto && a : query.path()) {
+        ASSERT_EQ(graph.arc_source(a), u);
+        u = graph.arc_target(a);
+        length += length_map[a];
+    }
+    ASSERT_EQ(u, t);
+    ASSERT_EQ(length, st_dist);
+}
+
+template <typename G, typename L>
+void check_alt_queries(const G & graph, const L & length_map,
+                       const alt_landmarks<G, L> & landmarks) {
+    for(auto && u : graph.vertices())
+        for(auto && v : graph.vertices())
+            ASSERT_GE(landmarks.lower_bound(u, v), 0);
+
+    alt_dijkstra astar(graph, length_map, landmarks);
+    alt_bidirectional_dijkstra bidir(graph, length_map, landmarks);
+    for(auto && s : graph.vertices()) {
+        dijkstra<G, L, alt_reference_dijkstra_traits<G, L>> alg(graph,
+                                                                length_map, s);
+        alg.run();
+        for(auto && t : graph.vertices()) {
+            if(alg.reached(t)) {
+                ASSERT_LE(landmarks.lower_bound(s, t), alg.dist(t));
+            }
+
+            astar.reset();
+            astar.add_source(s).add_target(t);
+            const int astar_dist = astar.run();
+            ASSERT_EQ(astar.path_found(), alg.reached(t));
+
+            bidir.reset();
+            bidir.add_source(s).add_target(t);
+            const int bidir_dist = bidir.run();
+            ASSERT_EQ(bidir.path_found(), alg.reached(t));
+
+            if(!alg.reached(t)) continue;
+            ASSERT_EQ(astar_dist, alg.dist(t));
+            ASSERT_EQ(bidir_dist, alg.dist(t));
+            check_alt_path(graph, length_map, astar, s, t, astar_dist);
+            check_alt_path(graph, length_map, bidir, s, t, bidir_dist);
+        }
+    }
+}
+
+GTEST_TEST(alt, test) {
+    static_digraph_builder<static_digraph, int> builder(6);
+
+    builder.add_arc(0, 1, 7)
+        .add_arc(0, 2, 9)
+        .add_arc(0, 5, 14)
+        .add_arc(1, 0, 7)
+        .add_arc(1, 2, 10)
+        .add_arc(1, 3, 15)
+        .add_arc(2, 0, 9)
+        .add_arc(2, 1, 10)
+        .add_arc(2, 3, 12)
+        .add_arc(2, 5, 2)
+        .add_arc(3, 1, 15)
+        .add_arc(3, 2, 12)
+        .add_arc(3, 4, 6)
+        .add_arc(4, 3, 6)
+        .add_arc(4, 5, 9)
+        .add_arc(5, 0, 14)
+        .add_arc(5, 2, 2)
+        .add_arc(5, 4, 9);
+
+    auto [graph, length_map] = builder.build();
+
+    alt_landmarks landmarks(graph, length_map, std::vector<unsigned>{0, 4});
+    ASSERT_EQ(landmarks.nb_landmarks(), 2);
+    ASSERT_EQ(landmarks.dist_from(0, 3), 21);
+    ASSERT_EQ(landmarks.dist_to(1, 0), 20);
+    ASSERT_EQ(landmarks.lower_bound(0, 4), 20);
+
+    alt_dijkstra astar(graph, length_map, landmarks, 0u, 3u);
+    ASSERT_EQ(astar.run(), 21);
+    ASSERT_EQ(astar.path(), std::vector<unsigned>({1, 8}));
+
+    alt_bidirectional_dijkstra bidir(graph, length_map, landmarks, 0u, 3u);
+    ASSERT_EQ(bidir.run(), 21);
+    ASSERT_EQ(bidir.path(), std::vector<unsigned>({1, 8}));
+
+    check_alt_queries(graph, length_map, landmarks);
+}
+
+GTEST_TEST(alt, grid_test) {
+    const unsigned width = 12;
+    const unsigned height = 10;
+    auto [graph, length_map] = random_grid<int>(width, height, 1, 20);
+
+    const auto farthest = select_farthest_landmarks(graph, length_map, 4);
+    ASSERT_EQ(farthest.size(), 4);
+    const auto avoid = select_avoid_landmarks(graph, length_map, 4);
+    ASSERT_FALSE(avoid.empty());
+    for(auto && landmarks_vertices : {farthest, avoid}) {
+        std::vector<unsigned> sorted = landmarks_vertices;
+        std::ranges::sort(sorted);
+        ASSERT_EQ(std::ranges::unique(sorted).begin(), sorted.end());
+    }
+
+    const alt_landmarks farthest_landmarks(graph, length_map, farthest);
+    const alt_landmarks avoid_landmarks(graph, length_map, avoid,
+                                        parallel_policy{1});
+    check_alt_queries(graph, length_map, farthest_landmarks);
+    check_alt_queries(graph, length_map, avoid_landmarks);
+    check_alt_settles_fewer(graph, length_map, farthest_landmarks);
+    check_alt_settles_fewer(graph, length_map, avoid_landmarks);
+}
+
+GTEST_TEST(alt, fuzzy_test) {
+    for(unsigned it = 0; it < 3; ++it) {
+        const std::size_t nb_vertices = 60;
+        const std::size_t nb_arcs = 200;
+        auto sources = random_vector<unsigned>(nb_arcs, 0, nb_vertices - 1);
+        auto targets = random_vector<unsigned>(nb_arcs, 0, nb_vertices - 1);
+        auto lengths = random_vector<int>(nb_arcs, 0, 50);
+        static_digraph_builder<static_digraph, int> builder(nb_vertices);
+        for(std::size_t i = 0; i < nb_arcs; ++i)
+            builder.add_arc(sources[i], targets[i], lengths[i]);
+        auto [graph, length_map] = builder.build();
+
+        check_alt_queries(
+            graph, length_map,
+            alt_landmarks(graph, length_map,
+                          select_farthest_landmarks(graph, length_map, 3)));
+        check_alt_queries(
+            graph, length_map,
+            alt_landmarks(graph, length_map,
+                          select_avoid_landmarks(graph, length_map, 3, it)));
+    }
+}
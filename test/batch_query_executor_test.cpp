@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "melon/algorithm/bidirectional_dijkstra.hpp"
+#include "melon/algorithm/breadth_first_search.hpp"
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/batch_query_executor.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+#include "random_ranges_helper.hpp"
+
+using namespace fhamonic::melon;
+
+template <typename G, typename L>
+struct batch_reference_dijkstra_traits : public dijkstra_default_traits<G, L> {
+    static constexpr bool store_distances = true;
+};
+
+struct batch_bfs_traits {
+    static constexpr bool store_pred_vertices = false;
+    static constexpr bool store_pred_arcs = false;
+    static constexpr bool store_distances = true;
+};
+
+GTEST_TEST(batch_query_executor, bidirectional_dijkstra_test) {
+    const std::size_t nb_vertices = 200;
+    const std::size_t nb_arcs = 800;
+    auto arc_sources = random_vector<unsigned>(nb_arcs, 0, nb_vertices - 1);
+    auto arc_targets = random_vector<unsigned>(nb_arcs, 0, nb_vertices - 1);
+    auto lengths = random_vector<int>(nb_arcs, 0, 50);
+    static_digraph_builder<static_digraph, int> builder(nb_vertices);
+    for(std::size_t i = 0; i < nb_arcs; ++i)
+        builder.add_arc(arc_sources[i], arc_targets[i], lengths[i]);
+    auto [graph, length_map] = builder.build();
+    using G = decltype(graph);
+    using L = decltype(length_map);
+
+    const std::size_t nb_queries = 500;
+    const auto sources =
+        random_vector<unsigned>(nb_queries, 0, nb_vertices - 1);
+    auto targets = random_vector<unsigned>(nb_queries, 0, nb_vertices - 1);
+    std::vector<std::pair<unsigned, unsigned>> queries;
+    for(std::size_t i = 0; i < nb_queries; ++i) {
+        // bidirectional_dijkstra expects distinct source and target
+        if(targets[i] == sources[i])
+            targets[i] = (sources[i] + 1) % nb_vertices;
+        queries.emplace_back(sources[i], targets[i]);
+    }
+    std::vector<int> results(nb_queries);
+
+    batch_query_executor executor(
+        [&] { return bidirectional_dijkstra(graph, length_map); },
+        parallel_policy{4});
+    ASSERT_EQ(executor.nb_threads(), 4);
+    for(int batch = 0; batch < 2; ++batch) {
+        std::ranges::fill(results, -1);
+        const batch_statistics stats = executor.run(
+            queries, results, [](auto & alg, const auto & query) {
+                alg.reset();
+                alg.add_source(query.first).add_target(query.second);
+                return alg.run();
+            });
+        ASSERT_EQ(stats.nb_queries, nb_queries);
+        ASSERT_GE(stats.queries_per_second(), 0);
+
+        for(std::size_t i = 0; i < nb_queries; ++i) {
+            dijkstra<G, L, batch_reference_dijkstra_traits<G, L>> alg(
+                graph, length_map, sources[i]);
+            alg.run();
+            if(alg.reached(targets[i]))
+                ASSERT_EQ(results[i], alg.dist(targets[i]));
+            else
+                ASSERT_EQ(results[i], shortest_path_semiring<int>::infty);
+        }
+    }
+}
+
+GTEST_TEST(batch_query_executor, breadth_first_search_test) {
+    static_digraph_builder<static_digraph> builder(6);
+    builder.add_arc(0, 1).add_arc(1, 2).add_arc(2, 3).add_arc(3, 4).add_arc(
+        0, 3);
+    auto [graph] = builder.build();
+
+    const std::vector<std::pair<unsigned, unsigned>> queries = {
+        {0, 4}, {0, 2}, {1, 4}, {4, 0}, {5, 5}, {2, 3}};
+    std::vector<int> results(queries.size());
+
+    batch_query_executor executor(
+        [&] {
+            return breadth_first_search<static_digraph, batch_bfs_traits>(
+                graph);
+        },
+        parallel_policy{3});
+    executor.run(queries, results, [](auto & bfs, const auto & query) {
+        bfs.reset();
+        bfs.add_source(query.first);
+        bfs.run();
+        return bfs.reached(query.second) ? bfs.dist(query.second) : -1;
+    });
+    ASSERT_EQ(results, std::vector<int>({2, 2, 3, -1, 0, 1}));
+}
+
+GTEST_TEST(batch_query_executor, empty_and_exception_test) {
+    batch_query_executor executor([] { return 0; }, parallel_policy{2});
+    std::vector<int> queries;
+    std::vector<int> results;
+    ASSERT_EQ(executor
+                  .run(queries, results,
+                       [](int &, const int & q) { return q; })
+                  .nb_queries,
+              0);
+
+    queries = random_vector<int>(100, 0, 9);
+    queries[57] = 10;
+    results.resize(100);
+    ASSERT_THROW(executor.run(queries, results,
+                              [](int &, const int & q) -> int {
+                                  if(q == 10) throw std::runtime_error("");
+                                  return q;
+                              }),
+                 std::runtime_error);
+}
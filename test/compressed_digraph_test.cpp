@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "melon/algorithm/breadth_first_search.hpp"
+#include "melon/algorithm/topological_sort.hpp"
+#include "melon/container/compressed_digraph.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/graph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+#include "random_ranges_helper.hpp"
+#include "ranges_test_helper.hpp"
+
+using namespace fhamonic;
+using namespace fhamonic::melon;
+
+static_assert(melon::graph<compressed_digraph>);
+static_assert(!melon::outward_incidence_graph<compressed_digraph>);
+static_assert(melon::outward_adjacency_graph<compressed_digraph>);
+static_assert(melon::has_vertex_map<compressed_digraph>);
+static_assert(std::ranges::forward_range<
+              out_neighbors_range_t<compressed_digraph>>);
+
+GTEST_TEST(compressed_digraph, empty_constructor) {
+    compressed_digraph graph;
+    ASSERT_EQ(nb_vertices(graph), 0);
+    ASSERT_EQ(nb_arcs(graph), 0);
+    ASSERT_TRUE(EMPTY(vertices(graph)));
+
+    ASSERT_FALSE(is_valid_vertex(graph, 0));
+    EXPECT_DEATH((void)out_neighbors(graph, 0), "");
+}
+
+GTEST_TEST(compressed_digraph, vectors_constructor) {
+    std::vector<vertex_t<compressed_digraph>> sources = {0, 0, 0, 2, 2, 3, 3};
+    std::vector<vertex_t<compressed_digraph>> targets = {5, 1, 1, 0, 4, 3, 0};
+
+    compressed_digraph graph(6, sources, targets);
+    ASSERT_EQ(nb_vertices(graph), 6);
+    ASSERT_EQ(nb_arcs(graph), 7);
+    ASSERT_EQ(graph.nb_encoded_bytes(), 7);
+
+    ASSERT_TRUE(EQ_RANGES(vertices(graph), {0, 1, 2, 3, 4, 5}));
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(graph, 0), {1, 1, 5}));
+    ASSERT_TRUE(EMPTY(out_neighbors(graph, 1)));
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(graph, 2), {0, 4}));
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(graph, 3), {0, 3}));
+    ASSERT_TRUE(EMPTY(out_neighbors(graph, 4)));
+    ASSERT_TRUE(EMPTY(out_neighbors(graph, 5)));
+}
+
+GTEST_TEST(compressed_digraph, random_graph) {
+    const std::size_t nb_vertices = 2000;
+    auto sources = random_vector<unsigned int>(20000, 0, nb_vertices - 1);
+    auto targets = random_vector<unsigned int>(20000, 0, nb_vertices - 1);
+    std::ranges::sort(sources);
+
+    static_digraph_builder<static_digraph> builder(nb_vertices);
+    for(std::size_t i = 0; i < sources.size(); ++i)
+        builder.add_arc(sources[i], targets[i]);
+    auto [expected_graph] = builder.build();
+    compressed_digraph graph(nb_vertices, sources, targets);
+
+    ASSERT_EQ(nb_arcs(graph), sources.size());
+    ASSERT_LT(graph.nb_encoded_bytes(),
+              sources.size() * sizeof(vertex_t<compressed_digraph>));
+    for(auto && u : vertices(graph))
+        ASSERT_TRUE(EQ_RANGES(out_neighbors(graph, u),
+                              out_neighbors(expected_graph, u)));
+}
+
+GTEST_TEST(compressed_digraph, breadth_first_search) {
+    std::vector<vertex_t<compressed_digraph>> sources = {0, 0, 1, 2, 3};
+    std::vector<vertex_t<compressed_digraph>> targets = {1, 2, 3, 3, 4};
+    compressed_digraph graph(6, sources, targets);
+
+    std::vector<vertex_t<compressed_digraph>> traversal;
+    for(auto && u : breadth_first_search(graph, 0u)) traversal.push_back(u);
+    ASSERT_EQ(traversal, (std::vector<vertex_t<compressed_digraph>>{
+                             0, 1, 2, 3, 4}));
+}
+
+GTEST_TEST(compressed_digraph, topological_sort) {
+    std::vector<vertex_t<compressed_digraph>> sources = {2, 3, 4, 4, 5, 5};
+    std::vector<vertex_t<compressed_digraph>> targets = {3, 1, 0, 1, 2, 0};
+    compressed_digraph graph(6, sources, targets);
+
+    std::vector<vertex_t<compressed_digraph>> traversal;
+    for(auto && u : topological_sort(graph)) traversal.push_back(u);
+    ASSERT_EQ(traversal, (std::vector<vertex_t<compressed_digraph>>{
+                             4, 5, 0, 2, 3, 1}));
+}
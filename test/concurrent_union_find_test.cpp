@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "melon/container/concurrent_union_find.hpp"
+#include "melon/container/union_find.hpp"
+#include "melon/detail/parallel.hpp"
+
+#include "random_ranges_helper.hpp"
+
+using namespace fhamonic::melon;
+
+GTEST_TEST(concurrent_union_find, join_find) {
+    concurrent_union_find uf(6);
+    ASSERT_EQ(uf.size(), 6);
+    for(unsigned k = 0; k < 6; ++k) ASSERT_EQ(uf.find(k), k);
+
+    ASSERT_TRUE(uf.join(1u, 0u));
+    ASSERT_TRUE(uf.join(3u, 2u));
+    ASSERT_FALSE(uf.join(0u, 1u));
+    ASSERT_TRUE(uf.connected(0u, 1u));
+    ASSERT_FALSE(uf.connected(1u, 2u));
+
+    ASSERT_TRUE(uf.join(3u, 1u));
+    ASSERT_EQ(uf.find(3u), 0u);
+    ASSERT_EQ(uf.find(2u), 0u);
+    ASSERT_FALSE(uf.connected(4u, 5u));
+}
+
+GTEST_TEST(concurrent_union_find, parallel_join) {
+    const std::size_t n = 10000;
+    const std::size_t m = 8000;
+    auto sources = random_vector<unsigned>(m, 0, n - 1);
+    auto targets = random_vector<unsigned>(m, 0, n - 1);
+
+    union_find expected(n);
+    for(std::size_t i = 0; i < m; ++i) expected.join(sources[i], targets[i]);
+
+    concurrent_union_find uf(n);
+    std::vector<char> linked(m);
+    __detail::parallel_for(parallel_policy{4}, m, [&](std::size_t i) {
+        linked[i] = uf.join(sources[i], targets[i]);
+    });
+
+    std::size_t nb_links = 0;
+    for(auto && l : linked) nb_links += static_cast<std::size_t>(l);
+    ASSERT_EQ(n - nb_links, expected.nb_components());
+    for(unsigned u = 0; u < n; ++u) {
+        ASSERT_EQ(uf.connected(u, sources[u % m]),
+                  expected.connected(u, sources[u % m]));
+        ASSERT_LE(uf.find(u), u);
+    }
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "melon/algorithm/contraction_hierarchy.hpp"
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+#include "random_grid_helper.hpp"
+#include "random_ranges_helper.hpp"
+
+using namespace fhamonic::melon;
+
+template <typename G, typename L>
+struct ch_dijkstra_traits : public dijkstra_default_traits<G, L> {
+    static constexpr bool store_distances = true;
+};
+
+template <typename G, typename L, typename CH>
+void check_hierarchy(const G & graph, const L & length_map, const CH & ch) {
+    for(auto && a : ch.upward_graph().arcs())
+        ASSERT_LT(ch.rank(ch.upward_graph().arc_source(a)),
+                  ch.rank(ch.upward_graph().arc_target(a)));
+    for(auto && a : ch.downward_graph().arcs())
+        ASSERT_LT(ch.rank(ch.downward_graph().arc_source(a)),
+                  ch.rank(ch.downward_graph().arc_target(a)));
+
+    contraction_hierarchy_query query(ch);
+    for(auto && s : graph.vertices()) {
+        dijkstra<G, L, ch_dijkstra_traits<G, L>> alg(graph, length_map, s);
+        alg.run();
+        for(auto && t : graph.vertices()) {
+            query.reset();
+            query.add_source(s).add_target(t);
+            const auto st_dist = query.run();
+            ASSERT_EQ(query.path_found(), alg.reached(t));
+            if(!alg.reached(t)) continue;
+            ASSERT_EQ(st_dist, alg.dist(t));
+            auto u = s;
+            int length = 0;
+            for(auto && a : query.path()) {
+                ASSERT_EQ(graph.arc_source(a), u);
+                u = graph.arc_target(a);
+                length += length_map[a];
+            }
+            ASSERT_EQ(u, t);
+            ASSERT_EQ(length, st_dist);
+        }
+    }
+}
+
+GTEST_TEST(contraction_hierarchy, test) {
+    static_digraph_builder<static_digraph, int> builder(6);
+
+    builder.add_arc(0, 1, 7)
+        .add_arc(0, 2, 9)
+        .add_arc(0, 5, 14)
+        .add_arc(1, 0, 7)
+        .add_arc(1, 2, 10)
+        .add_arc(1, 3, 15)
+        .add_arc(2, 0, 9)
+        .add_arc(2, 1, 10)
+        .add_arc(2, 3, 12)
+        .add_arc(2, 5, 2)
+        .add_arc(3, 1, 15)
+        .add_arc(3, 2, 12)
+        .add_arc(3, 4, 6)
+        .add_arc(4, 3, 6)
+        .add_arc(4, 5, 9)
+        .add_arc(5, 0, 14)
+        .add_arc(5, 2, 2)
+        .add_arc(5, 4, 9);
+
+    auto [graph, length_map] = builder.build();
+
+    contraction_hierarchy ch(graph, length_map);
+    contraction_hierarchy_query query(ch, 0u, 3u);
+    ASSERT_EQ(query.run(), 21);
+    ASSERT_TRUE(query.path_found());
+    ASSERT_EQ(query.path(), std::vector<unsigned>({1, 8}));
+
+    check_hierarchy(graph, length_map, ch);
+}
+
+GTEST_TEST(contraction_hierarchy, grid_test) {
+    // bidirected grid with random lengths, like a small road network
+    const unsigned width = 12;
+    const unsigned height = 10;
+    auto [graph, length_map] = random_grid<int>(width, height, 1, 20);
+
+    contraction_hierarchy ch(graph, length_map);
+    check_hierarchy(graph, length_map, ch);
+
+    // a small witness search limit only adds shortcuts
+    contraction_hierarchy ch2(graph, length_map, 2);
+    ASSERT_GE(ch2.nb_shortcuts(), ch.nb_shortcuts());
+    check_hierarchy(graph, length_map, ch2);
+}
+
+GTEST_TEST(contraction_hierarchy, fuzzy_test) {
+    for(int it = 0; it < 3; ++it) {
+        const std::size_t nb_vertices = 80;
+        const std::size_t nb_arcs = 300;
+        auto sources = random_vector<unsigned>(nb_arcs, 0, nb_vertices - 1);
+        auto targets = random_vector<unsigned>(nb_arcs, 0, nb_vertices - 1);
+        auto lengths = random_vector<int>(nb_arcs, 0, 50);
+        static_digraph_builder<static_digraph, int> builder(nb_vertices);
+        for(std::size_t i = 0; i < nb_arcs; ++i)
+            builder.add_arc(sources[i], targets[i], lengths[i]);
+        auto [graph, length_map] = builder.build();
+
+        contraction_hierarchy ch(graph, length_map);
+        check_hierarchy(graph, length_map, ch);
+    }
+}
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <string>
+
 #include <range/v3/algorithm/sort.hpp>
 #include <range/v3/view/zip.hpp>
 
@@ -140,4 +142,52 @@ GTEST_TEST(d_ary_heap, 2_heap_promote_test) {
     ASSERT_EQ(heap.top(), std::make_pair(2ul, 3));
     heap.pop();
     ASSERT_TRUE(heap.empty());
-}
\ No newline at end of file
+}
+
+GTEST_TEST(d_ary_heap, 2_heap_demote_test) {
+    std::vector<int> datas = {0, 7, 3, 5, 6, 11};
+    d_ary_heap<2, std::size_t, int> heap;
+    for(std::size_t i = 0; i < datas.size(); ++i) {
+        heap.push(i, datas[i]);
+    }
+    heap.demote(5ul, 4);
+
+    ASSERT_EQ(heap.top(), std::make_pair(1ul, 7));
+    heap.pop();
+    ASSERT_EQ(heap.top(), std::make_pair(4ul, 6));
+    heap.pop();
+    ASSERT_EQ(heap.top(), std::make_pair(3ul, 5));
+    heap.pop();
+    ASSERT_EQ(heap.top(), std::make_pair(5ul, 4));
+    heap.pop();
+    ASSERT_EQ(heap.top(), std::make_pair(2ul, 3));
+    heap.pop();
+    ASSERT_EQ(heap.top(), std::make_pair(0ul, 0));
+    heap.pop();
+    ASSERT_TRUE(heap.empty());
+}
+
+GTEST_TEST(d_ary_heap, contains_test) {
+    d_ary_heap<2, unsigned, int> heap;
+    heap.push(3u, 5);
+    heap.push(1u, 7);
+    heap.push(8u, 2);
+    ASSERT_TRUE(heap.contains(3u));
+    ASSERT_TRUE(heap.contains(1u));
+    ASSERT_TRUE(heap.contains(8u));
+    ASSERT_FALSE(heap.contains(0u));
+    ASSERT_FALSE(heap.contains(20u));
+    heap.pop();
+    ASSERT_FALSE(heap.contains(1u));
+    ASSERT_TRUE(heap.contains(8u));
+}
+
+GTEST_TEST(d_ary_heap, non_integral_keys_test) {
+    d_ary_heap<2, std::string, int> heap;
+    heap.push("a", 5);
+    heap.push("b", 7);
+    heap.promote("a", 9);
+    ASSERT_EQ(heap.top(), std::make_pair(std::string("a"), 9));
+    ASSERT_TRUE(heap.contains("b"));
+}
+
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <vector>
+
+#include "melon/algorithm/delta_stepping.hpp"
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+#include "random_ranges_helper.hpp"
+
+using namespace fhamonic::melon;
+
+GTEST_TEST(delta_stepping, test) {
+    static_digraph_builder<static_digraph, int> builder(7);
+
+    builder.add_arc(0, 1, 7)
+        .add_arc(0, 2, 9)
+        .add_arc(0, 5, 14)
+        .add_arc(1, 0, 7)
+        .add_arc(1, 2, 10)
+        .add_arc(1, 3, 15)
+        .add_arc(2, 0, 9)
+        .add_arc(2, 1, 10)
+        .add_arc(2, 3, 12)
+        .add_arc(2, 5, 2)
+        .add_arc(3, 1, 15)
+        .add_arc(3, 2, 12)
+        .add_arc(3, 4, 6)
+        .add_arc(4, 3, 6)
+        .add_arc(4, 5, 9)
+        .add_arc(5, 0, 14)
+        .add_arc(5, 2, 2)
+        .add_arc(5, 4, 9);
+
+    auto [graph, length_map] = builder.build();
+
+    delta_stepping alg(graph, length_map, 5, 0u, parallel_policy{2});
+    alg.run();
+    const std::vector<int> expected = {0, 7, 9, 21, 20, 11};
+    for(unsigned u = 0; u < 6; ++u) {
+        ASSERT_TRUE(alg.reached(u));
+        ASSERT_EQ(alg.dist(u), expected[u]);
+    }
+    ASSERT_FALSE(alg.reached(6u));
+
+    alg.reset();
+    ASSERT_FALSE(alg.reached(0u));
+    alg.add_source(3u).run();
+    ASSERT_EQ(alg.dist(0u), 21);
+}
+
+GTEST_TEST(delta_stepping, fuzzy_test) {
+    const std::size_t nb_vertices = 500;
+    const std::size_t nb_arcs = 4000;
+    auto sources = random_vector<unsigned>(nb_arcs, 0, nb_vertices - 1);
+    auto targets = random_vector<unsigned>(nb_arcs, 0, nb_vertices - 1);
+    auto lengths = random_vector<unsigned>(nb_arcs, 0, 1000);
+
+    static_digraph_builder<static_digraph, unsigned> builder(nb_vertices);
+    for(std::size_t i = 0; i < nb_arcs; ++i)
+        builder.add_arc(sources[i], targets[i], lengths[i]);
+    auto [graph, length_map] = builder.build();
+
+    std::vector<std::optional<unsigned>> expected(nb_vertices);
+    for(auto && [u, dist] : dijkstra(graph, length_map, 0u)) expected[u] = dist;
+
+    for(unsigned delta : {1u, 50u, 300u, 2000u}) {
+        for(std::size_t nb_threads : {1ul, 4ul}) {
+            delta_stepping alg(graph, length_map, delta, 0u,
+                               parallel_policy{nb_threads});
+            alg.run();
+            for(unsigned u = 0; u < nb_vertices; ++u) {
+                ASSERT_EQ(alg.reached(u), expected[u].has_value());
+                if(expected[u].has_value()) {
+                    ASSERT_EQ(alg.dist(u), expected[u]);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "melon/container/dial_heap.hpp"
+#include "melon/container/static_map.hpp"
+
+#include "random_ranges_helper.hpp"
+
+using namespace fhamonic::melon;
+
+// The cases shared with radix_heap are in monotone_heap_test.cpp, these ones
+// cover the circular bucket array.
+
+GTEST_TEST(dial_heap, wrap_around_test) {
+    dial_heap<std::size_t, unsigned> heap;
+    // priorities 0 to 3 fill the 4 buckets
+    for(unsigned p = 0; p < 4; ++p) heap.push(p, p);
+    ASSERT_EQ(heap.top(), std::make_pair(0ul, 0u));
+    heap.pop();
+    ASSERT_EQ(heap.top(), std::make_pair(1ul, 1u));
+    heap.pop();
+    // 4 and 5 wrap around to the buckets of 0 and 1 without growing the array
+    heap.push(4ul, 5u);
+    heap.push(5ul, 4u);
+    ASSERT_EQ(heap.priority(4ul), 5u);
+    ASSERT_EQ(heap.priority(5ul), 4u);
+    ASSERT_TRUE(heap.contains(4ul));
+    ASSERT_FALSE(heap.contains(0ul));
+    for(unsigned p = 2; p < 6; ++p) {
+        ASSERT_FALSE(heap.empty());
+        ASSERT_EQ(heap.top().second, p);
+        heap.pop();
+    }
+    ASSERT_TRUE(heap.empty());
+}
+
+// Dijkstra like sequence of pushes of the last popped priority plus a random
+// length, checked against a std::multimap.
+GTEST_TEST(dial_heap, fuzzy_wrap_around_test) {
+    for(unsigned max_length : {3u, 16u, 100u}) {
+        std::mt19937 engine{std::random_device{}()};
+        std::uniform_int_distribution<unsigned> length_distr{0u, max_length};
+        dial_heap<std::size_t, unsigned> heap;
+        std::multimap<unsigned, std::size_t> expected;
+        std::size_t nb_keys = 0;
+        for(; nb_keys < 5; ++nb_keys) {
+            const unsigned p = length_distr(engine);
+            heap.push(nb_keys, p);
+            expected.emplace(p, nb_keys);
+        }
+        while(!expected.empty()) {
+            ASSERT_FALSE(heap.empty());
+            ASSERT_EQ(heap.size(), expected.size());
+            const auto [k, p] = heap.top();
+            ASSERT_EQ(p, expected.begin()->first);
+            auto it = std::ranges::find_if(
+                expected, [k](auto && e) { return e.second == k; });
+            ASSERT_NE(it, expected.end());
+            ASSERT_EQ(it->first, p);
+            expected.erase(it);
+            heap.pop();
+            for(unsigned i = 0; i < 2 && nb_keys < 2000; ++i, ++nb_keys) {
+                const unsigned q = p + length_distr(engine);
+                heap.push(nb_keys, q);
+                expected.emplace(q, nb_keys);
+            }
+        }
+        ASSERT_TRUE(heap.empty());
+    }
+}
+
+GTEST_TEST(dial_heap, reserve_spread_test) {
+    dial_heap<unsigned, unsigned, static_map<unsigned, std::size_t>> heap(
+        static_map<unsigned, std::size_t>(8, 0));
+    heap.push(0u, 10u);
+    heap.push(1u, 11u);
+    heap.push(2u, 12u);
+    heap.pop();
+    heap.push(3u, 13u);
+    // the spread becomes 90 so the queued entries are moved to 128 buckets
+    heap.push(4u, 100u);
+    for(unsigned k = 1; k < 5; ++k) ASSERT_TRUE(heap.contains(k));
+    ASSERT_FALSE(heap.contains(0u));
+    ASSERT_EQ(heap.priority(1u), 11u);
+    ASSERT_EQ(heap.priority(2u), 12u);
+    ASSERT_EQ(heap.priority(3u), 13u);
+    ASSERT_EQ(heap.priority(4u), 100u);
+    // their indices must still be valid for promote
+    heap.promote(4u, 12u);
+    heap.push(5u, 300u);
+    heap.promote(3u, 11u);
+    ASSERT_EQ(heap.top().second, 11u);
+    heap.pop();
+    ASSERT_EQ(heap.top().second, 11u);
+    heap.pop();
+    ASSERT_EQ(heap.top().second, 12u);
+    heap.pop();
+    ASSERT_EQ(heap.top().second, 12u);
+    heap.pop();
+    ASSERT_EQ(heap.top(), std::make_pair(5u, 300u));
+    heap.pop();
+    ASSERT_TRUE(heap.empty());
+}
+
+GTEST_TEST(dial_heap, promote_below_current_test) {
+    dial_heap<unsigned, unsigned, static_map<unsigned, std::size_t>> heap(
+        static_map<unsigned, std::size_t>(4, 0));
+    heap.push(0u, 0u);
+    heap.push(1u, 3u);
+    heap.pop();
+    heap.push(2u, 4u);
+    // 1 is below the minimum queued priority 3, within the 4 buckets
+    heap.promote(2u, 1u);
+    ASSERT_EQ(heap.top(), std::make_pair(2u, 1u));
+    // 0 to 4 spans 5 priorities so the array grows to 8 buckets
+    heap.push(3u, 4u);
+    heap.promote(1u, 0u);
+    ASSERT_EQ(heap.priority(1u), 0u);
+    ASSERT_EQ(heap.priority(2u), 1u);
+    ASSERT_EQ(heap.priority(3u), 4u);
+    ASSERT_EQ(heap.top(), std::make_pair(1u, 0u));
+    heap.pop();
+    ASSERT_EQ(heap.top(), std::make_pair(2u, 1u));
+    heap.pop();
+    ASSERT_EQ(heap.top(), std::make_pair(3u, 4u));
+    heap.pop();
+    ASSERT_TRUE(heap.empty());
+}
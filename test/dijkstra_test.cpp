@@ -1,9 +1,14 @@
 #include <gtest/gtest.h>
 
+#include <optional>
+#include <vector>
+
 #include "melon/algorithm/dijkstra.hpp"
+#include "melon/container/epoch_map.hpp"
 #include "melon/container/static_digraph.hpp"
 #include "melon/utility/static_digraph_builder.hpp"
 
+#include "random_ranges_helper.hpp"
 #include "ranges_test_helper.hpp"
 
 using namespace fhamonic::melon;
@@ -98,3 +103,211 @@ GTEST_TEST(dijkstra, traversal_iterator) {
         ++cpt;
     }
 }
+
+template <typename G, typename L>
+struct lazy_deletion_traits : public dijkstra_lazy_deletion_traits<G, L> {
+    static constexpr bool store_distances = true;
+    static constexpr bool store_paths = true;
+};
+
+GTEST_TEST(dijkstra, lazy_deletion_test) {
+    static_digraph_builder<static_digraph, int> builder(6);
+
+    builder.add_arc(0, 1, 7)
+        .add_arc(0, 2, 9)
+        .add_arc(0, 5, 14)
+        .add_arc(1, 0, 7)
+        .add_arc(1, 2, 10)
+        .add_arc(1, 3, 15)
+        .add_arc(2, 0, 9)
+        .add_arc(2, 1, 10)
+        .add_arc(2, 3, 12)
+        .add_arc(2, 5, 2)
+        .add_arc(3, 1, 15)
+        .add_arc(3, 2, 12)
+        .add_arc(3, 4, 6)
+        .add_arc(4, 3, 6)
+        .add_arc(4, 5, 9)
+        .add_arc(5, 0, 14)
+        .add_arc(5, 2, 2)
+        .add_arc(5, 4, 9);
+
+    auto [graph, length_map] = builder.build();
+
+    using length_map_t = decltype(length_map);
+    dijkstra<static_digraph, length_map_t,
+             lazy_deletion_traits<static_digraph, length_map_t>>
+        alg(graph, length_map);
+
+    static_assert(std::copyable<decltype(alg)>);
+
+    std::vector traversal = {std::make_pair(0u, 0),  std::make_pair(1u, 7),
+                             std::make_pair(2u, 9),  std::make_pair(5u, 11),
+                             std::make_pair(4u, 20), std::make_pair(3u, 21)};
+
+    alg.add_source(0);
+    for(auto && entry : traversal) {
+        ASSERT_FALSE(alg.finished());
+        ASSERT_EQ(alg.current(), entry);
+        alg.advance();
+    }
+    ASSERT_TRUE(alg.finished());
+    ASSERT_EQ(alg.dist(5u), 11);
+    ASSERT_EQ(alg.pred_vertex(5u), 2u);
+    ASSERT_EQ(alg.pred_vertex(3u), 2u);
+    alg.reset();
+    alg.add_source(3);
+    ASSERT_EQ(alg.current(), std::make_pair(3u, 0));
+}
+
+GTEST_TEST(dijkstra, lazy_deletion_fuzzy_test) {
+    const std::size_t nb_vertices = 200;
+    const std::size_t nb_arcs = 2000;
+    auto sources = random_vector<unsigned>(nb_arcs, 0, nb_vertices - 1);
+    auto targets = random_vector<unsigned>(nb_arcs, 0, nb_vertices - 1);
+    auto lengths = random_vector<unsigned>(nb_arcs, 0, 1000);
+
+    static_digraph_builder<static_digraph, unsigned> builder(nb_vertices);
+    for(std::size_t i = 0; i < nb_arcs; ++i)
+        builder.add_arc(sources[i], targets[i], lengths[i]);
+    auto [graph, length_map] = builder.build();
+
+    std::vector<std::optional<unsigned>> expected(nb_vertices);
+    for(auto && [u, dist] : dijkstra(graph, length_map, 0u)) expected[u] = dist;
+
+    using length_map_t = decltype(length_map);
+    dijkstra<static_digraph, length_map_t,
+             dijkstra_lazy_deletion_traits<static_digraph, length_map_t>>
+        alg(graph, length_map, 0u);
+    std::vector<bool> visited(nb_vertices, false);
+    for(auto && [u, dist] : alg) {
+        ASSERT_FALSE(visited[u]);
+        ASSERT_EQ(expected[u], dist);
+        visited[u] = true;
+    }
+    for(std::size_t u = 0; u < nb_vertices; ++u)
+        ASSERT_EQ(visited[u], expected[u].has_value());
+}
+
+template <typename G, typename L>
+struct stopping_criteria_traits : public dijkstra_default_traits<G, L> {
+    static constexpr bool store_distances = true;
+    static constexpr bool bounded_distance = true;
+    static constexpr bool stop_at_targets = true;
+    static constexpr bool bounded_nb_settled = true;
+};
+
+template <typename G, typename L>
+struct stop_at_targets_traits : public dijkstra_default_traits<G, L> {
+    static constexpr bool stop_at_targets = true;
+};
+
+GTEST_TEST(dijkstra, stopping_criteria_test) {
+    static_digraph_builder<static_digraph, int> builder(6);
+
+    builder.add_arc(0, 1, 7)
+        .add_arc(0, 2, 9)
+        .add_arc(0, 5, 14)
+        .add_arc(1, 0, 7)
+        .add_arc(1, 2, 10)
+        .add_arc(1, 3, 15)
+        .add_arc(2, 0, 9)
+        .add_arc(2, 1, 10)
+        .add_arc(2, 3, 12)
+        .add_arc(2, 5, 2)
+        .add_arc(3, 1, 15)
+        .add_arc(3, 2, 12)
+        .add_arc(3, 4, 6)
+        .add_arc(4, 3, 6)
+        .add_arc(4, 5, 9)
+        .add_arc(5, 0, 14)
+        .add_arc(5, 2, 2)
+        .add_arc(5, 4, 9);
+
+    auto [graph, length_map] = builder.build();
+
+    using length_map_t = decltype(length_map);
+    dijkstra<static_digraph, length_map_t,
+             stopping_criteria_traits<static_digraph, length_map_t>>
+        alg(graph, length_map);
+
+    // no targets : the search ends immediately
+    alg.add_source(0);
+    ASSERT_TRUE(alg.finished());
+
+    alg.reset();
+    alg.add_source(0).add_target(5).add_target(1).add_target(5);
+    alg.run();
+    ASSERT_EQ(alg.nb_settled(), 4);
+    ASSERT_TRUE(alg.visited(5u));
+    ASSERT_FALSE(alg.visited(4u));
+    ASSERT_EQ(alg.dist(5u), 11);
+
+    alg.reset();
+    alg.set_distance_bound(11);
+    alg.add_source(0).add_target(3);
+    alg.run();
+    ASSERT_EQ(alg.nb_settled(), 4);
+    ASSERT_TRUE(alg.visited(5u));
+    ASSERT_FALSE(alg.reached(4u));
+    ASSERT_FALSE(alg.reached(3u));
+
+    alg.reset();
+    alg.set_distance_bound(100).set_max_nb_settled(3);
+    alg.add_source(0).add_target(3);
+    std::vector<unsigned> settled;
+    for(auto && [u, u_dist] : alg) settled.push_back(u);
+    ASSERT_EQ(settled, std::vector<unsigned>({0, 1, 2}));
+
+    dijkstra<static_digraph, length_map_t,
+             stop_at_targets_traits<static_digraph, length_map_t>>
+        targets_alg(graph, length_map, 0u);
+    targets_alg.add_target(5u).run();
+    ASSERT_EQ(targets_alg.nb_settled(), 4);
+    ASSERT_TRUE(targets_alg.visited(5u));
+    ASSERT_FALSE(targets_alg.visited(4u));
+}
+
+template <typename G, typename L>
+struct bounded_lazy_deletion_traits
+    : public dijkstra_lazy_deletion_traits<G, L> {
+    static constexpr bool bounded_distance = true;
+    template <typename K, typename V>
+    using resettable_vertex_map = epoch_map<K, V>;
+};
+
+GTEST_TEST(dijkstra, bounded_distance_fuzzy_test) {
+    const std::size_t nb_vertices = 200;
+    const std::size_t nb_arcs = 2000;
+    auto sources = random_vector<unsigned>(nb_arcs, 0, nb_vertices - 1);
+    auto targets = random_vector<unsigned>(nb_arcs, 0, nb_vertices - 1);
+    auto lengths = random_vector<unsigned>(nb_arcs, 0, 1000);
+
+    static_digraph_builder<static_digraph, unsigned> builder(nb_vertices);
+    for(std::size_t i = 0; i < nb_arcs; ++i)
+        builder.add_arc(sources[i], targets[i], lengths[i]);
+    auto [graph, length_map] = builder.build();
+
+    using length_map_t = decltype(length_map);
+    dijkstra<static_digraph, length_map_t,
+             bounded_lazy_deletion_traits<static_digraph, length_map_t>>
+        alg(graph, length_map);
+    for(unsigned s = 0; s < 10; ++s) {
+        std::vector<std::optional<unsigned>> expected(nb_vertices);
+        for(auto && [u, dist] : dijkstra(graph, length_map, s))
+            expected[u] = dist;
+
+        const unsigned bound = 300 * s;
+        alg.reset();
+        alg.set_distance_bound(bound).add_source(s);
+        std::vector<bool> visited(nb_vertices, false);
+        for(auto && [u, dist] : alg) {
+            ASSERT_FALSE(visited[u]);
+            ASSERT_EQ(expected[u], dist);
+            visited[u] = true;
+        }
+        for(std::size_t u = 0; u < nb_vertices; ++u)
+            ASSERT_EQ(visited[u],
+                      expected[u].has_value() && expected[u].value() <= bound);
+    }
+}
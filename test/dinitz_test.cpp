@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+
+#include "melon/algorithm/dinitz.hpp"
+#include "melon/algorithm/edmonds_karp.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+#include "random_grid_helper.hpp"
+#include "random_ranges_helper.hpp"
+#include "ranges_test_helper.hpp"
+
+using namespace fhamonic::melon;
+
+GTEST_TEST(dinitz, no_arcs) {
+    static_digraph_builder<static_digraph, int, char> builder(2);
+
+    auto [graph, capacity, part_of_minimum_cut] = builder.build();
+
+    dinitz alg(graph, capacity, 0u, 1u);
+    ASSERT_EQ(alg.run().flow_value(), 0);
+    ASSERT_TRUE(EMPTY(alg.minimum_cut()));
+    alg.reset();
+    ASSERT_EQ(alg.flow_value(), 0);
+    ASSERT_EQ(alg.run().flow_value(), 0);
+}
+
+GTEST_TEST(dinitz, arc_with_0_capacity) {
+    static_digraph_builder<static_digraph, int> builder(2);
+
+    builder.add_arc(0, 1, 0);
+
+    auto [graph, capacity] = builder.build();
+
+    dinitz alg(graph, capacity, 0u, 1u);
+    ASSERT_EQ(alg.run().flow_value(), 0);
+    ASSERT_TRUE(EQ_MULTISETS(alg.minimum_cut(), {0u}));
+    alg.reset();
+    ASSERT_EQ(alg.run().flow_value(), 0);
+    ASSERT_TRUE(EQ_MULTISETS(alg.minimum_cut(), {0u}));
+}
+
+GTEST_TEST(dinitz, arc_with_fixed_capacity) {
+    static_digraph_builder<static_digraph, int> builder(2);
+
+    builder.add_arc(0, 1, 107);
+
+    auto [graph, capacity] = builder.build();
+
+    dinitz alg(graph, capacity, 0u, 1u);
+    ASSERT_EQ(alg.run().flow_value(), 107);
+    ASSERT_TRUE(EQ_MULTISETS(alg.minimum_cut(), {0u}));
+    alg.reset();
+    ASSERT_EQ(alg.flow_value(), 0);
+    ASSERT_EQ(alg.run().flow_value(), 107);
+}
+
+GTEST_TEST(dinitz, source_is_target) {
+    static_digraph_builder<static_digraph, int> builder(3);
+
+    builder.add_arc(0, 1, 5).add_arc(1, 0, 7).add_arc(1, 2, 3);
+
+    auto [graph, capacity] = builder.build();
+
+    dinitz alg(graph, capacity, 0u, 0u);
+    ASSERT_EQ(alg.run().flow_value(), 0);
+    alg.reset();
+    ASSERT_EQ(alg.flow_value(), 0);
+    ASSERT_EQ(alg.set_target(2u).run().flow_value(), 3);
+    alg.reset();
+    ASSERT_EQ(alg.set_source(2u).set_target(2u).run().flow_value(), 0);
+}
+
+GTEST_TEST(dinitz, test) {
+    static_digraph_builder<static_digraph, int, char> builder(6);
+
+    // example from https://www.geeksforgeeks.org/max-flow-problem-introduction/
+    builder.add_arc(0, 1, 16, false);
+    builder.add_arc(0, 2, 13, false);
+    builder.add_arc(1, 2, 10, false);
+    builder.add_arc(1, 3, 12, true); //
+    builder.add_arc(2, 1, 4, false);
+    builder.add_arc(2, 4, 14, false);
+    builder.add_arc(3, 2, 9, false);
+    builder.add_arc(3, 5, 20, false);
+    builder.add_arc(4, 3, 7, true); //
+    builder.add_arc(4, 5, 4, true); //
+
+    auto [graph, capacity, part_of_minimum_cut] = builder.build();
+
+    dinitz alg(graph, capacity, 0u, 5u);
+    ASSERT_EQ(alg.run().flow_value(), 23);
+    ASSERT_TRUE(EQ_MULTISETS(
+        alg.minimum_cut(), std::views::filter(arcs(graph), [&](const auto & a) {
+            return part_of_minimum_cut[a];
+        })));
+    alg.reset();
+    ASSERT_EQ(alg.run().flow_value(), 23);
+}
+
+#include "melon/views/complete_digraph.hpp"
+#include "melon/utility/value_map.hpp"
+
+GTEST_TEST(dinitz, complete_digraph_view) {
+    auto graph = views::complete_digraph<>(5ul);
+    dinitz alg(graph, views::map([](const auto &) { return 1; }), 0u, 1u);
+    ASSERT_EQ(alg.run().flow_value(), 4);
+    alg.reset();
+    ASSERT_EQ(alg.run().flow_value(), 4);
+}
+
+template <typename G, typename C>
+void check_dinitz(const G & graph, const C & capacity, const unsigned s,
+                  const unsigned t) {
+    edmonds_karp reference(graph, capacity, s, t);
+    const int expected_flow = reference.run().flow_value();
+
+    dinitz alg(graph, capacity, s, t);
+    ASSERT_EQ(alg.run().flow_value(), expected_flow);
+    int cut_capacity = 0;
+    for(auto && a : alg.minimum_cut()) cut_capacity += capacity[a];
+    ASSERT_EQ(cut_capacity, expected_flow);
+}
+
+GTEST_TEST(dinitz, layered_network_test) {
+    // source, layers of vertices fully linked to the next layer, target
+    const unsigned nb_layers = 6;
+    const unsigned layer_size = 8;
+    const unsigned s = nb_layers * layer_size;
+    const unsigned t = s + 1;
+    static_digraph_builder<static_digraph, int> builder(t + 1);
+    auto capacities = random_vector<int>(
+        nb_layers * layer_size * layer_size + 2 * layer_size, 1, 30);
+    std::size_t i = 0;
+    for(unsigned v = 0; v < layer_size; ++v) {
+        builder.add_arc(s, v, capacities[i++]);
+        builder.add_arc((nb_layers - 1) * layer_size + v, t, capacities[i++]);
+    }
+    for(unsigned l = 0; l + 1 < nb_layers; ++l)
+        for(unsigned u = 0; u < layer_size; ++u)
+            for(unsigned v = 0; v < layer_size; ++v)
+                builder.add_arc(l * layer_size + u, (l + 1) * layer_size + v,
+                                capacities[i++]);
+    auto [graph, capacity] = builder.build();
+
+    check_dinitz(graph, capacity, s, t);
+}
+
+GTEST_TEST(dinitz, grid_network_test) {
+    const unsigned width = 15;
+    const unsigned height = 10;
+    auto [graph, capacity] = random_grid<int>(width, height, 0, 20);
+
+    check_dinitz(graph, capacity, 0u, width * height - 1);
+}
+
+GTEST_TEST(dinitz, fuzzy_test) {
+    for(int it = 0; it < 10; ++it) {
+        const std::size_t nb_vertices = 50;
+        const std::size_t nb_arcs = 300;
+        auto sources = random_vector<unsigned>(nb_arcs, 0, nb_vertices - 1);
+        auto targets = random_vector<unsigned>(nb_arcs, 0, nb_vertices - 1);
+        auto capacities = random_vector<int>(nb_arcs, 0, 50);
+        static_digraph_builder<static_digraph, int> builder(nb_vertices);
+        for(std::size_t i = 0; i < nb_arcs; ++i)
+            builder.add_arc(sources[i], targets[i], capacities[i]);
+        auto [graph, capacity] = builder.build();
+
+        check_dinitz(graph, capacity, 0u, 1u);
+    }
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "melon/algorithm/breadth_first_search.hpp"
+#include "melon/algorithm/direction_optimizing_bfs.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+#include "random_ranges_helper.hpp"
+
+using namespace fhamonic::melon;
+
+namespace {
+struct bfs_distances_traits {
+    static constexpr bool store_pred_vertices = true;
+    static constexpr bool store_pred_arcs = false;
+    static constexpr bool store_distances = true;
+};
+
+struct dobfs_distances_traits : public direction_optimizing_bfs_default_traits {
+    static constexpr bool store_pred_vertices = true;
+    static constexpr bool store_pred_arcs = true;
+    static constexpr bool store_distances = true;
+};
+
+template <std::size_t A, std::size_t B>
+struct dobfs_traits : public dobfs_distances_traits {
+    static constexpr std::size_t alpha = A;
+    static constexpr std::size_t beta = B;
+};
+}  // namespace
+
+static static_digraph random_graph(const std::size_t nb_vertices,
+                                   const std::size_t nb_arcs) {
+    auto sources = random_vector<unsigned>(
+        nb_arcs, 0, static_cast<unsigned>(nb_vertices - 1));
+    auto targets = random_vector<unsigned>(
+        nb_arcs, 0, static_cast<unsigned>(nb_vertices - 1));
+    static_digraph_builder<static_digraph> builder(nb_vertices);
+    for(std::size_t i = 0; i < nb_arcs; ++i)
+        builder.add_arc(sources[i], targets[i]);
+    auto [graph] = builder.build();
+    return graph;
+}
+
+template <typename T>
+void check_against_bfs(const static_digraph & graph,
+                       const parallel_policy & policy) {
+    breadth_first_search<static_digraph, bfs_distances_traits> bfs(graph, 0u);
+    bfs.run();
+    direction_optimizing_bfs<static_digraph, T> alg(graph, 0u, policy);
+    alg.run();
+    for(auto && u : graph.vertices()) {
+        ASSERT_EQ(alg.reached(u), bfs.reached(u));
+        if(!bfs.reached(u) || u == 0u) continue;
+        ASSERT_EQ(alg.dist(u), bfs.dist(u));
+        ASSERT_EQ(alg.dist(alg.pred_vertex(u)) + 1, alg.dist(u));
+        ASSERT_EQ(graph.arc_source(alg.pred_arc(u)), alg.pred_vertex(u));
+        ASSERT_EQ(graph.arc_target(alg.pred_arc(u)), u);
+    }
+}
+
+GTEST_TEST(direction_optimizing_bfs, test) {
+    static_digraph_builder<static_digraph> builder(8);
+
+    builder.add_arc(0, 1)
+        .add_arc(0, 2)
+        .add_arc(0, 5)
+        .add_arc(1, 3)
+        .add_arc(2, 3)
+        .add_arc(3, 4)
+        .add_arc(5, 4)
+        .add_arc(7, 5);
+
+    auto [graph] = builder.build();
+
+    direction_optimizing_bfs<static_digraph, dobfs_distances_traits> alg(graph,
+                                                                         0u);
+    alg.run();
+    const std::vector<int> expected = {0, 1, 1, 2, 2, 1};
+    for(unsigned u = 0; u < 6; ++u) {
+        ASSERT_TRUE(alg.reached(u));
+        ASSERT_EQ(alg.dist(u), expected[u]);
+    }
+    ASSERT_FALSE(alg.reached(6u));
+    ASSERT_FALSE(alg.reached(7u));
+
+    alg.reset();
+    alg.add_source(7u);
+    alg.run();
+    ASSERT_EQ(alg.dist(4u), 2);
+    ASSERT_FALSE(alg.reached(0u));
+}
+
+GTEST_TEST(direction_optimizing_bfs, fuzzy_test) {
+    for(int it = 0; it < 5; ++it) {
+        const auto graph = random_graph(1000, 6000);
+        check_against_bfs<dobfs_distances_traits>(
+            graph, parallel_policy{1});
+        // bottom-up at every step
+        check_against_bfs<dobfs_traits<1000000, 1000000>>(graph,
+                                                          parallel_policy{1});
+        check_against_bfs<dobfs_traits<1000000, 1000000>>(graph,
+                                                          parallel_policy{4});
+        // switching back and forth
+        check_against_bfs<dobfs_traits<2, 4>>(graph, parallel_policy{3});
+    }
+}
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <utility>
+
+#include "melon/algorithm/breadth_first_search.hpp"
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/container/epoch_map.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/container/touched_map.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+#include "melon/utility/value_map.hpp"
+
+#include "ranges_test_helper.hpp"
+
+using namespace fhamonic::melon;
+
+static_assert(output_value_map_of<epoch_map<std::size_t, int>, std::size_t, int>);
+static_assert(
+    output_value_map_of<touched_map<std::size_t, int>, std::size_t, int>);
+
+GTEST_TEST(epoch_map, fill) {
+    epoch_map<std::size_t, int> map(5, 3);
+    ASSERT_EQ(map.size(), 5);
+    ASSERT_EQ(std::as_const(map)[2], 3);
+    map[2] = 7;
+    map[4] = 9;
+    ASSERT_EQ(std::as_const(map)[2], 7);
+    ASSERT_EQ(std::as_const(map)[4], 9);
+    map.fill(1);
+    for(std::size_t i = 0; i < 5; ++i) ASSERT_EQ(std::as_const(map)[i], 1);
+    map[0] += 2;
+    ASSERT_EQ(map[0], 3);
+    ASSERT_EQ(map[4], 1);
+}
+
+GTEST_TEST(epoch_map, epoch_wrap_around) {
+    epoch_map<std::size_t, int, unsigned char> map(3, 0);
+    for(int i = 0; i < 600; ++i) {
+        map[static_cast<std::size_t>(i % 3)] = i;
+        map.fill(-1);
+        ASSERT_EQ(std::as_const(map)[static_cast<std::size_t>(i % 3)], -1);
+    }
+}
+
+GTEST_TEST(touched_map, fill) {
+    touched_map<std::size_t, int> map(5, 3);
+    ASSERT_EQ(map.size(), 5);
+    map[2] = 7;
+    map[2] = 8;
+    map[4] = 9;
+    ASSERT_EQ(std::as_const(map)[2], 8);
+    map.fill(3);
+    for(std::size_t i = 0; i < 5; ++i) ASSERT_EQ(std::as_const(map)[i], 3);
+    map[1] = 5;
+    map.fill(0);
+    for(std::size_t i = 0; i < 5; ++i) ASSERT_EQ(std::as_const(map)[i], 0);
+}
+
+namespace {
+struct epoch_bfs_traits : public breadth_first_search_default_traits {
+    template <typename K, typename V>
+    using resettable_vertex_map = epoch_map<K, V>;
+};
+
+template <typename G, typename L>
+struct touched_dijkstra_traits : public dijkstra_default_traits<G, L> {
+    static constexpr bool store_distances = true;
+    template <typename K, typename V>
+    using resettable_vertex_map = touched_map<K, V>;
+};
+}  // namespace
+
+GTEST_TEST(epoch_map, breadth_first_search_reset) {
+    static_digraph_builder<static_digraph> builder(5);
+    builder.add_arc(0, 1).add_arc(1, 2).add_arc(3, 4).add_arc(4, 0);
+    auto [graph] = builder.build();
+
+    breadth_first_search<static_digraph, epoch_bfs_traits> alg(graph);
+    static_assert(std::same_as<decltype(alg)::reached_map,
+                               epoch_map<vertex_t<static_digraph>, bool>>);
+    alg.add_source(0).run();
+    ASSERT_TRUE(alg.reached(2));
+    ASSERT_FALSE(alg.reached(3));
+    alg.reset().add_source(3).run();
+    for(auto && u : vertices(graph)) ASSERT_TRUE(alg.reached(u));
+    alg.reset().add_source(2).run();
+    ASSERT_TRUE(alg.reached(2));
+    ASSERT_FALSE(alg.reached(0));
+}
+
+GTEST_TEST(touched_map, dijkstra_reset) {
+    static_digraph_builder<static_digraph, int> builder(4);
+    builder.add_arc(0, 1, 3).add_arc(1, 2, 4).add_arc(0, 2, 9).add_arc(2, 3, 1);
+    auto [graph, lengths] = builder.build();
+
+    dijkstra<static_digraph, decltype(lengths),
+             touched_dijkstra_traits<static_digraph, decltype(lengths)>>
+        alg(graph, lengths);
+    alg.add_source(0).run();
+    ASSERT_EQ(alg.dist(3), 8);
+    alg.reset().add_source(1).run();
+    ASSERT_FALSE(alg.reached(0));
+    ASSERT_EQ(alg.dist(3), 5);
+}
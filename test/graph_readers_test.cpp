@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/graph_readers.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+#include "ranges_test_helper.hpp"
+
+using namespace fhamonic::melon;
+
+namespace {
+struct temporary_file {
+    std::filesystem::path path;
+    temporary_file(const char * name, const std::string & content)
+        : path(std::filesystem::temp_directory_path() / name) {
+        std::ofstream(path) << content;
+    }
+    ~temporary_file() { std::filesystem::remove(path); }
+};
+
+using arc_list = std::vector<std::pair<std::size_t, std::size_t>>;
+
+arc_list arcs_of(const static_digraph & graph) {
+    arc_list arc_pairs;
+    for(auto && a : arcs(graph))
+        arc_pairs.emplace_back(arc_source(graph, a), arc_target(graph, a));
+    return arc_pairs;
+}
+}  // namespace
+
+GTEST_TEST(graph_readers, read_dimacs_gr) {
+    temporary_file file("melon_test.gr",
+                        "c 9th DIMACS challenge graph\n"
+                        "p sp 4 5\n"
+                        "c arcs\n"
+                        "a 1 2 7\n"
+                        "a 1 3 9\n"
+                        "a 3 2 1\n"
+                        "a 2 4 15\n"
+                        "a 4 1 3");
+    for(std::size_t nb_threads : {1u, 2u, 8u}) {
+        auto [graph, lengths] =
+            read_dimacs_gr<static_digraph, int>(file.path,
+                                                parallel_policy{nb_threads})
+                .build();
+        ASSERT_EQ(nb_vertices(graph), 4);
+        ASSERT_EQ(arcs_of(graph),
+                  (arc_list{{0, 1}, {0, 2}, {1, 3}, {2, 1}, {3, 0}}));
+        ASSERT_EQ(lengths, (std::vector<int>{7, 9, 15, 1, 3}));
+    }
+    auto [graph] = read_dimacs_gr(file.path).build();
+    ASSERT_EQ(nb_arcs(graph), 5);
+}
+
+GTEST_TEST(graph_readers, read_dimacs_gr_invalid_vertex) {
+    temporary_file file("melon_test_invalid.gr", "p sp 2 1\na 1 3 5\n");
+    ASSERT_THROW((void)read_dimacs_gr(file.path), std::runtime_error);
+}
+
+GTEST_TEST(graph_readers, read_dimacs_gr_out_of_range) {
+    temporary_file overflow_file("melon_test_overflow.gr",
+                                 "p sp 2 1\na 1 99999999999999999999999 5\n");
+    ASSERT_THROW((void)read_dimacs_gr(overflow_file.path), std::runtime_error);
+    temporary_file nb_vertices_file("melon_test_nb_vertices.gr",
+                                    "p sp 4294967296 1\na 1 2 5\n");
+    ASSERT_THROW((void)read_dimacs_gr(nb_vertices_file.path),
+                 std::runtime_error);
+}
+
+GTEST_TEST(graph_readers, read_snap) {
+    temporary_file file("melon_test.snap",
+                        "# Directed graph\n"
+                        "# FromNodeId\tToNodeId\n"
+                        "0\t1\n"
+                        "2\t0\n"
+                        "\n"
+                        "1\t4\n"
+                        "0\t2\n");
+    for(std::size_t nb_threads : {1u, 3u}) {
+        auto [graph] =
+            read_snap<static_digraph>(file.path, parallel_policy{nb_threads})
+                .build();
+        ASSERT_EQ(nb_vertices(graph), 5);
+        ASSERT_EQ(arcs_of(graph), (arc_list{{0, 1}, {0, 2}, {1, 4}, {2, 0}}));
+    }
+}
+
+GTEST_TEST(graph_readers, read_snap_weighted) {
+    temporary_file file("melon_test_weighted.snap",
+                        "0 1 0.5 3\n"
+                        "1 0 1.5 4\n");
+    auto [graph, weights, labels] =
+        read_snap<static_digraph, double, int>(file.path).build();
+    ASSERT_EQ(arcs_of(graph), (arc_list{{0, 1}, {1, 0}}));
+    ASSERT_EQ(weights, (std::vector<double>{0.5, 1.5}));
+    ASSERT_EQ(labels, (std::vector<int>{3, 4}));
+}
+
+GTEST_TEST(graph_readers, read_snap_out_of_range) {
+    temporary_file file("melon_test_out_of_range.snap", "0 1\n4294967295 0\n");
+    ASSERT_THROW((void)read_snap(file.path), std::runtime_error);
+}
+
+GTEST_TEST(graph_readers, read_metis) {
+    temporary_file file("melon_test.metis",
+                        "% triangle with a pendant vertex\n"
+                        "4 4\n"
+                        "2 3\n"
+                        "1 3\n"
+                        "1 2 4\n"
+                        "3\n");
+    for(std::size_t nb_threads : {1u, 2u, 4u}) {
+        auto [graph, weights] =
+            read_metis<static_digraph, int>(file.path,
+                                            parallel_policy{nb_threads})
+                .build();
+        ASSERT_EQ(nb_vertices(graph), 4);
+        ASSERT_EQ(arcs_of(graph), (arc_list{{0, 1},
+                                            {0, 2},
+                                            {1, 0},
+                                            {1, 2},
+                                            {2, 0},
+                                            {2, 1},
+                                            {2, 3},
+                                            {3, 2}}));
+        ASSERT_EQ(weights, std::vector<int>(8, 1));
+    }
+}
+
+GTEST_TEST(graph_readers, read_metis_weighted) {
+    temporary_file file("melon_test_weighted.metis",
+                        "3 2 11\n"
+                        "5 2 4\n"
+                        "1 1 4 3 6\n"
+                        "2 2 6\n");
+    auto [graph, weights] = read_metis<static_digraph, int>(file.path).build();
+    ASSERT_EQ(arcs_of(graph), (arc_list{{0, 1}, {1, 0}, {1, 2}, {2, 1}}));
+    ASSERT_EQ(weights, (std::vector<int>{4, 4, 6, 6}));
+}
+
+GTEST_TEST(graph_readers, read_metis_wrong_edge_count) {
+    temporary_file file("melon_test_wrong.metis", "2 2\n2\n1\n");
+    ASSERT_THROW((void)read_metis(file.path), std::runtime_error);
+}
+
+GTEST_TEST(graph_readers, read_metis_out_of_range) {
+    temporary_file vertex_file("melon_test_out_of_range.metis",
+                               "2 1\n2\n3\n");
+    ASSERT_THROW((void)read_metis(vertex_file.path), std::runtime_error);
+    temporary_file edges_file("melon_test_overflow.metis",
+                              "2 18446744073709551615\n2\n1\n");
+    ASSERT_THROW((void)read_metis(edges_file.path), std::runtime_error);
+}
@@ -0,0 +1,37 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "melon/container/growable_map.hpp"
+#include "melon/utility/value_map.hpp"
+
+using namespace fhamonic::melon;
+
+static_assert(output_value_map<growable_map<unsigned, std::uint32_t>, unsigned>);
+static_assert(std::same_as<__detail::default_indices_map_t<int, std::uint32_t>,
+                           growable_map<int, std::uint32_t>>);
+static_assert(
+    std::same_as<__detail::default_indices_map_t<std::string, std::uint32_t>,
+                 std::unordered_map<std::string, std::uint32_t>>);
+
+GTEST_TEST(growable_map, empty_constructor) {
+    growable_map<unsigned, int> map;
+    ASSERT_EQ(map.size(), 0);
+    ASSERT_EQ(std::as_const(map)[7], 0);
+    ASSERT_EQ(map.size(), 0);
+}
+
+GTEST_TEST(growable_map, grows_on_write) {
+    growable_map<unsigned, int> map(2);
+    ASSERT_EQ(map.size(), 2);
+    map[5] = 3;
+    ASSERT_EQ(map.size(), 6);
+    ASSERT_EQ(map[5], 3);
+    ASSERT_EQ(std::as_const(map)[4], 0);
+    map[1] = 2;
+    ASSERT_EQ(map.size(), 6);
+    map.fill(9);
+    ASSERT_EQ(std::as_const(map)[1], 9);
+    ASSERT_EQ(std::as_const(map)[5], 9);
+    ASSERT_EQ(std::as_const(map)[6], 0);
+}
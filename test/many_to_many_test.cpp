@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "melon/algorithm/contraction_hierarchy.hpp"
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/algorithm/many_to_many.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+#include "random_ranges_helper.hpp"
+
+using namespace fhamonic::melon;
+
+template <typename G, typename L>
+struct many_to_many_reference_traits : public dijkstra_default_traits<G, L> {
+    static constexpr bool store_distances = true;
+};
+
+template <typename G, typename L, typename DT>
+void check_distance_table(const G & graph, const L & length_map,
+                          const std::vector<unsigned> & sources,
+                          const std::vector<unsigned> & targets,
+                          const DT & table) {
+    ASSERT_EQ(table.nb_sources(), sources.size());
+    ASSERT_EQ(table.nb_targets(), targets.size());
+    for(std::size_t i = 0; i < sources.size(); ++i) {
+        dijkstra<G, L, many_to_many_reference_traits<G, L>> alg(
+            graph, length_map, sources[i]);
+        alg.run();
+        for(std::size_t j = 0; j < targets.size(); ++j) {
+            if(alg.reached(targets[j]))
+                ASSERT_EQ(table.dist(i, j), alg.dist(targets[j]));
+            else
+                ASSERT_EQ(table.dist(i, j), table.infty);
+        }
+    }
+}
+
+GTEST_TEST(many_to_many, test) {
+    static_digraph_builder<static_digraph, int> builder(6);
+
+    builder.add_arc(0, 1, 7)
+        .add_arc(0, 2, 9)
+        .add_arc(0, 5, 14)
+        .add_arc(1, 0, 7)
+        .add_arc(1, 2, 10)
+        .add_arc(1, 3, 15)
+        .add_arc(2, 0, 9)
+        .add_arc(2, 1, 10)
+        .add_arc(2, 3, 12)
+        .add_arc(2, 5, 2)
+        .add_arc(3, 1, 15)
+        .add_arc(3, 2, 12)
+        .add_arc(3, 4, 6)
+        .add_arc(4, 3, 6)
+        .add_arc(4, 5, 9)
+        .add_arc(5, 0, 14)
+        .add_arc(5, 2, 2);
+
+    auto [graph, length_map] = builder.build();
+
+    // repeated targets get the same column values
+    const std::vector<unsigned> sources = {0, 4};
+    const std::vector<unsigned> targets = {3, 4, 3};
+    const auto table =
+        many_to_many_distances(graph, length_map, sources, targets);
+    ASSERT_EQ(table.dist(0, 0), 21);
+    ASSERT_EQ(table.dist(0, 1), 27);
+    ASSERT_EQ(table.dist(0, 2), 21);
+    ASSERT_EQ(table.dist(1, 0), 6);
+    ASSERT_EQ(table.dist(1, 1), 0);
+
+    contraction_hierarchy ch(graph, length_map);
+    const auto ch_table =
+        contraction_hierarchy_many_to_many(ch, sources, targets);
+    for(std::size_t i = 0; i < sources.size(); ++i)
+        for(std::size_t j = 0; j < targets.size(); ++j)
+            ASSERT_EQ(ch_table.dist(i, j), table.dist(i, j));
+}
+
+GTEST_TEST(many_to_many, fuzzy_test) {
+    for(int it = 0; it < 3; ++it) {
+        const std::size_t nb_vertices = 100;
+        const std::size_t nb_arcs = 350;
+        auto arc_sources =
+            random_vector<unsigned>(nb_arcs, 0, nb_vertices - 1);
+        auto arc_targets =
+            random_vector<unsigned>(nb_arcs, 0, nb_vertices - 1);
+        auto lengths = random_vector<int>(nb_arcs, 0, 50);
+        static_digraph_builder<static_digraph, int> builder(nb_vertices);
+        for(std::size_t i = 0; i < nb_arcs; ++i)
+            builder.add_arc(arc_sources[i], arc_targets[i], lengths[i]);
+        auto [graph, length_map] = builder.build();
+
+        const auto sources = random_vector<unsigned>(30, 0, nb_vertices - 1);
+        const auto targets = random_vector<unsigned>(40, 0, nb_vertices - 1);
+
+        check_distance_table(
+            graph, length_map, sources, targets,
+            many_to_many_distances(graph, length_map, sources, targets));
+        check_distance_table(graph, length_map, sources, targets,
+                             many_to_many_distances(graph, length_map, sources,
+                                                    targets,
+                                                    parallel_policy{1}));
+
+        contraction_hierarchy ch(graph, length_map);
+        check_distance_table(
+            graph, length_map, sources, targets,
+            contraction_hierarchy_many_to_many(ch, sources, targets));
+        check_distance_table(graph, length_map, sources, targets,
+                             contraction_hierarchy_many_to_many(
+                                 ch, sources, targets, parallel_policy{3}));
+    }
+}
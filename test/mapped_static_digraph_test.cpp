@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/container/mapped_static_digraph.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/graph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+#include "ranges_test_helper.hpp"
+
+using namespace fhamonic;
+using namespace fhamonic::melon;
+
+static_assert(melon::graph<mapped_static_digraph>);
+static_assert(melon::outward_incidence_graph<mapped_static_digraph>);
+static_assert(melon::outward_adjacency_graph<mapped_static_digraph>);
+static_assert(melon::inward_incidence_graph<mapped_static_digraph>);
+static_assert(melon::inward_adjacency_graph<mapped_static_digraph>);
+static_assert(melon::has_vertex_map<mapped_static_digraph>);
+static_assert(melon::has_arc_map<mapped_static_digraph>);
+
+namespace {
+struct temporary_file {
+    std::filesystem::path path;
+    explicit temporary_file(const char * name)
+        : path(std::filesystem::temp_directory_path() / name) {}
+    ~temporary_file() { std::filesystem::remove(path); }
+};
+
+using file_section = __detail::static_digraph_file_section;
+
+file_section read_section(const std::filesystem::path & path,
+                          const std::size_t i) {
+    file_section s;
+    std::ifstream in(path, std::ios::binary);
+    in.seekg(static_cast<std::streamoff>(
+        sizeof(__detail::static_digraph_file_header) + i * sizeof(s)));
+    in.read(reinterpret_cast<char *>(&s), sizeof(s));
+    return s;
+}
+
+template <typename T>
+void overwrite(const std::filesystem::path & path, const std::uint64_t offset,
+               const T & value) {
+    std::fstream out(path, std::ios::binary | std::ios::in | std::ios::out);
+    out.seekp(static_cast<std::streamoff>(offset));
+    out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+void overwrite_section(const std::filesystem::path & path,
+                       const std::size_t i, const file_section & s) {
+    overwrite(path,
+              sizeof(__detail::static_digraph_file_header) + i * sizeof(s),
+              s);
+}
+}  // namespace
+
+GTEST_TEST(mapped_static_digraph, round_trip) {
+    static_digraph_builder<static_digraph, int> builder(6);
+    builder.add_arc(0, 1, 7)
+        .add_arc(0, 2, 9)
+        .add_arc(0, 5, 14)
+        .add_arc(1, 0, 7)
+        .add_arc(1, 2, 10)
+        .add_arc(1, 3, 15)
+        .add_arc(2, 0, 9)
+        .add_arc(2, 1, 10)
+        .add_arc(2, 3, 12)
+        .add_arc(2, 5, 2)
+        .add_arc(3, 1, 15)
+        .add_arc(3, 2, 12)
+        .add_arc(3, 4, 6)
+        .add_arc(4, 3, 6)
+        .add_arc(4, 5, 9)
+        .add_arc(5, 0, 14)
+        .add_arc(5, 2, 2)
+        .add_arc(5, 4, 9);
+    auto [graph, length_map] = builder.build();
+    std::vector<double> potentials = {0.5, 1.5, 2.5, 3.5, 4.5, 5.5};
+
+    temporary_file file("melon_mapped_static_digraph_round_trip.bin");
+    mapped_static_digraph_writer(graph)
+        .add_vertex_map(potentials)
+        .add_arc_map(length_map)
+        .write(file.path);
+
+    mapped_static_digraph mapped(file.path);
+    ASSERT_NO_THROW(mapped.validate());
+    ASSERT_EQ(mapped.nb_vertices(), graph.nb_vertices());
+    ASSERT_EQ(mapped.nb_arcs(), graph.nb_arcs());
+    for(auto && u : graph.vertices()) {
+        ASSERT_TRUE(EQ_RANGES(mapped.out_arcs(u), graph.out_arcs(u)));
+        ASSERT_TRUE(EQ_RANGES(mapped.in_arcs(u), graph.in_arcs(u)));
+        ASSERT_TRUE(EQ_RANGES(mapped.out_neighbors(u), graph.out_neighbors(u)));
+    }
+    for(auto && a : graph.arcs()) {
+        ASSERT_EQ(mapped.arc_source(a), graph.arc_source(a));
+        ASSERT_EQ(mapped.arc_target(a), graph.arc_target(a));
+    }
+
+    ASSERT_EQ(mapped.nb_vertex_maps(), 1);
+    ASSERT_EQ(mapped.nb_arc_maps(), 1);
+    ASSERT_TRUE(EQ_RANGES(mapped.vertex_map<double>(0), potentials));
+    ASSERT_TRUE(EQ_RANGES(mapped.arc_map<int>(0), length_map));
+    ASSERT_THROW((void)mapped.arc_map<double>(0), std::runtime_error);
+    ASSERT_THROW((void)mapped.arc_map<int>(1), std::out_of_range);
+
+    auto mapped_length_map = mapped.arc_map<int>(0);
+    dijkstra alg(mapped, mapped_length_map);
+    alg.add_source(0);
+    std::vector<std::pair<vertex_t<static_digraph>, int>> expected = {
+        {0u, 0}, {1u, 7}, {2u, 9}, {5u, 11}, {4u, 20}, {3u, 21}};
+    for(auto && p : expected) {
+        ASSERT_FALSE(alg.finished());
+        ASSERT_EQ(alg.current(), p);
+        alg.advance();
+    }
+    ASSERT_TRUE(alg.finished());
+}
+
+GTEST_TEST(mapped_static_digraph, empty_graph) {
+    static_digraph graph;
+    temporary_file file("melon_mapped_static_digraph_empty.bin");
+    mapped_static_digraph_writer(graph).write(file.path);
+    mapped_static_digraph mapped(file.path);
+    ASSERT_EQ(mapped.nb_vertices(), 0);
+    ASSERT_EQ(mapped.nb_arcs(), 0);
+    ASSERT_TRUE(EMPTY(mapped.vertices()));
+    ASSERT_TRUE(EMPTY(mapped.arcs()));
+}
+
+GTEST_TEST(mapped_static_digraph, invalid_files) {
+    ASSERT_THROW(mapped_static_digraph("melon_this_file_does_not_exist.bin"),
+                 std::runtime_error);
+
+    temporary_file file("melon_mapped_static_digraph_invalid.bin");
+    {
+        std::ofstream out(file.path, std::ios::binary);
+        out << "definitely not a graph file, but long enough to have a header";
+    }
+    ASSERT_THROW(mapped_static_digraph{file.path}, std::runtime_error);
+
+    std::vector<int> wrong_size_map(3);
+    static_digraph graph(2, std::vector<unsigned int>{0},
+                         std::vector<unsigned int>{1});
+    mapped_static_digraph_writer writer(graph);
+    ASSERT_THROW(writer.add_arc_map(wrong_size_map), std::invalid_argument);
+    ASSERT_THROW(writer.add_vertex_map(wrong_size_map), std::invalid_argument);
+}
+
+GTEST_TEST(mapped_static_digraph, corrupted_files) {
+    static_digraph graph(3, std::vector<unsigned int>{0, 1},
+                         std::vector<unsigned int>{1, 2});
+    temporary_file file("melon_mapped_static_digraph_corrupted.bin");
+    auto write = [&] { mapped_static_digraph_writer(graph).write(file.path); };
+
+    // section sizes whose product overflows
+    write();
+    file_section targets_section = read_section(file.path, 1);
+    targets_section.nb_values = std::uint64_t{1} << 62;
+    overwrite_section(file.path, 1, targets_section);
+    ASSERT_THROW(mapped_static_digraph{file.path}, std::runtime_error);
+    targets_section.nb_values = 2;
+    targets_section.value_size = 0;
+    overwrite_section(file.path, 1, targets_section);
+    ASSERT_THROW(mapped_static_digraph{file.path}, std::runtime_error);
+
+    // in bounds sections with invalid contents are only found by validate
+    write();
+    targets_section = read_section(file.path, 1);
+    overwrite(file.path, targets_section.offset + sizeof(unsigned int), 3u);
+    {
+        mapped_static_digraph mapped(file.path);
+        ASSERT_THROW(mapped.validate(), std::runtime_error);
+    }
+    write();
+    const file_section out_begins_section = read_section(file.path, 0);
+    overwrite(file.path, out_begins_section.offset + 2 * sizeof(unsigned int),
+              0u);
+    {
+        mapped_static_digraph mapped(file.path);
+        ASSERT_THROW(mapped.validate(), std::runtime_error);
+    }
+}
+
+GTEST_TEST(mapped_static_digraph, custom_index_widths) {
+    using G = basic_static_digraph<std::uint16_t, std::uint64_t>;
+    G graph(4, std::vector<std::uint16_t>{0, 0, 2},
+            std::vector<std::uint16_t>{1, 3, 1});
+    temporary_file file("melon_mapped_static_digraph_widths.bin");
+    mapped_static_digraph_writer(graph).write(file.path);
+
+    ASSERT_THROW(mapped_static_digraph{file.path}, std::runtime_error);
+    basic_mapped_static_digraph<std::uint16_t, std::uint64_t> mapped(
+        file.path);
+    static_assert(std::same_as<vertex_t<decltype(mapped)>, std::uint16_t>);
+    static_assert(std::same_as<arc_t<decltype(mapped)>, std::uint64_t>);
+    for(auto && u : graph.vertices()) {
+        ASSERT_TRUE(EQ_RANGES(mapped.out_arcs(u), graph.out_arcs(u)));
+        ASSERT_TRUE(EQ_RANGES(mapped.in_arcs(u), graph.in_arcs(u)));
+    }
+}
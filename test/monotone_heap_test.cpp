@@ -0,0 +1,204 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/view/zip.hpp>
+
+#include "melon/algorithm/bidirectional_dijkstra.hpp"
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/container/dial_heap.hpp"
+#include "melon/container/radix_heap.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/priority_queue.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+#include "random_ranges_helper.hpp"
+#include "ranges_test_helper.hpp"
+
+using namespace fhamonic::melon;
+
+static_assert(updatable_priority_queue<radix_heap<std::size_t, int>>);
+static_assert(updatable_priority_queue<
+              radix_heap<unsigned, unsigned, static_map<unsigned, std::size_t>>>);
+static_assert(updatable_priority_queue<dial_heap<std::size_t, int>>);
+static_assert(updatable_priority_queue<
+              dial_heap<unsigned, unsigned, static_map<unsigned, std::size_t>>>);
+
+// Cases shared by the monotone integer heaps, each type giving the heap
+// template as heap<K, P, M>.
+namespace {
+struct radix_heap_type {
+    template <typename K, typename P,
+              typename M = __detail::default_indices_map_t<K, std::size_t>>
+    using heap = radix_heap<K, P, M>;
+};
+struct dial_heap_type {
+    template <typename K, typename P,
+              typename M = __detail::default_indices_map_t<K, std::size_t>>
+    using heap = dial_heap<K, P, M>;
+};
+
+template <typename H>
+class monotone_heap : public ::testing::Test {};
+using monotone_heap_types = ::testing::Types<radix_heap_type, dial_heap_type>;
+}  // namespace
+
+TYPED_TEST_SUITE(monotone_heap, monotone_heap_types);
+
+TYPED_TEST(monotone_heap, push_pop_test) {
+    std::vector<int> datas = {0, 7, 3, 5, 6, 11};
+    typename TypeParam::template heap<std::size_t, int> heap;
+    for(std::size_t i = 0; i < datas.size(); ++i) {
+        heap.push(i, datas[i]);
+    }
+    ASSERT_FALSE(heap.empty());
+    ASSERT_EQ(heap.top(), std::make_pair(0ul, 0));
+    heap.pop();
+    ASSERT_FALSE(heap.empty());
+    ASSERT_EQ(heap.top(), std::make_pair(2ul, 3));
+    heap.pop();
+    ASSERT_FALSE(heap.empty());
+    ASSERT_EQ(heap.top(), std::make_pair(3ul, 5));
+    heap.pop();
+    ASSERT_FALSE(heap.empty());
+    ASSERT_EQ(heap.top(), std::make_pair(4ul, 6));
+    heap.pop();
+    ASSERT_FALSE(heap.empty());
+    ASSERT_EQ(heap.top(), std::make_pair(1ul, 7));
+    heap.pop();
+    ASSERT_FALSE(heap.empty());
+    ASSERT_EQ(heap.top(), std::make_pair(5ul, 11));
+    heap.pop();
+    ASSERT_TRUE(heap.empty());
+}
+
+TYPED_TEST(monotone_heap, fuzzy_push_pop_test) {
+    for(int it = 0; it < 10; ++it) {
+        std::size_t size = 127;
+        std::vector<int> datas = random_vector_all_diff(size, 0, 1000);
+        std::vector<std::size_t> permuted_id(size);
+        std::iota(permuted_id.begin(), permuted_id.end(), 0);
+        auto zip_view = ranges::view::zip(datas, permuted_id);
+
+        typename TypeParam::template heap<std::size_t, int> heap;
+        for(std::size_t i = 0; i < size; ++i) {
+            heap.push(i, datas[i]);
+        }
+
+        ranges::sort(zip_view,
+                     [](auto p1, auto p2) { return p1.first < p2.first; });
+        for(std::size_t i = 0; i < size; ++i) {
+            ASSERT_FALSE(heap.empty());
+            ASSERT_EQ(heap.top(), std::make_pair(permuted_id[i], datas[i]));
+            heap.pop();
+        }
+        ASSERT_TRUE(heap.empty());
+    }
+}
+
+TYPED_TEST(monotone_heap, promote_contains_test) {
+    typename TypeParam::template heap<unsigned, unsigned,
+                                      static_map<unsigned, std::size_t>>
+        heap(static_map<unsigned, std::size_t>(5, 0));
+    heap.push(0, 4);
+    heap.push(1, 9);
+    heap.push(2, 20);
+    ASSERT_TRUE(heap.contains(1));
+    ASSERT_FALSE(heap.contains(3));
+    heap.pop();
+    ASSERT_FALSE(heap.contains(0));
+    heap.push(3, 17);
+    heap.promote(2, 5);
+    ASSERT_EQ(heap.priority(2), 5u);
+    ASSERT_EQ(heap.top(), std::make_pair(2u, 5u));
+    heap.pop();
+    heap.promote(3, 9);
+    ASSERT_EQ(heap.size(), 2);
+    ASSERT_EQ(heap.top().second, 9u);
+    heap.pop();
+    ASSERT_EQ(heap.top().second, 9u);
+    heap.pop();
+    ASSERT_TRUE(heap.empty());
+}
+
+namespace {
+template <typename H, typename G, typename L>
+struct monotone_heap_dijkstra_traits : public dijkstra_default_traits<G, L> {
+    using heap =
+        typename H::template heap<vertex_t<G>, mapped_value_t<L, arc_t<G>>,
+                                  vertex_map_t<G, std::size_t>>;
+    static constexpr bool store_distances = true;
+};
+}  // namespace
+
+TYPED_TEST(monotone_heap, dijkstra_test) {
+    const std::size_t nb_vertices = 200;
+    const std::size_t nb_arcs = 2000;
+    auto sources = random_vector<unsigned>(nb_arcs, 0, nb_vertices - 1);
+    auto targets = random_vector<unsigned>(nb_arcs, 0, nb_vertices - 1);
+    auto lengths = random_vector<unsigned>(nb_arcs, 0, 1000);
+
+    static_digraph_builder<static_digraph, unsigned> builder(nb_vertices);
+    for(std::size_t i = 0; i < nb_arcs; ++i)
+        builder.add_arc(sources[i], targets[i], lengths[i]);
+    auto [graph, length_map] = builder.build();
+
+    using length_map_t = std::remove_cvref_t<decltype(length_map)>;
+    dijkstra<static_digraph, length_map_t,
+             monotone_heap_dijkstra_traits<TypeParam, static_digraph,
+                                           length_map_t>>
+        alg(graph, length_map);
+    std::vector<std::optional<unsigned>> expected(nb_vertices);
+    for(auto && [u, dist] : dijkstra(graph, length_map, 0u)) expected[u] = dist;
+
+    alg.add_source(0u);
+    unsigned last_dist = 0;
+    std::size_t nb_reached = 0;
+    for(auto && [u, dist] : alg) {
+        ASSERT_LE(last_dist, dist);
+        ASSERT_EQ(expected[u], dist);
+        last_dist = dist;
+        ++nb_reached;
+    }
+    ASSERT_EQ(nb_reached, std::ranges::count_if(
+                              expected, [](auto && d) { return d.has_value(); }));
+}
+
+namespace {
+template <typename H, typename G, typename L>
+struct monotone_heap_bidirectional_dijkstra_traits
+    : public bidirectional_dijkstra_default_traits<G, L> {
+    using heap =
+        typename H::template heap<vertex_t<G>, mapped_value_t<L, arc_t<G>>,
+                                  vertex_map_t<G, std::size_t>>;
+};
+}  // namespace
+
+TYPED_TEST(monotone_heap, bidirectional_dijkstra_test) {
+    static_digraph_builder<static_digraph, int> builder(6);
+
+    builder.add_arc(0, 1, 7)
+        .add_arc(0, 2, 9)
+        .add_arc(0, 5, 14)
+        .add_arc(1, 2, 10)
+        .add_arc(1, 3, 15)
+        .add_arc(2, 3, 11)
+        .add_arc(2, 5, 2)
+        .add_arc(3, 4, 6)
+        .add_arc(5, 4, 9);
+
+    auto [graph, length_map] = builder.build();
+
+    using length_map_t = std::remove_cvref_t<decltype(length_map)>;
+    bidirectional_dijkstra<
+        static_digraph, length_map_t,
+        monotone_heap_bidirectional_dijkstra_traits<TypeParam, static_digraph,
+                                                    length_map_t>>
+        alg(graph, length_map, 0u, 4u);
+    ASSERT_EQ(alg.run(), 20);
+}
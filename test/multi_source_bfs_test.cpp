@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "melon/algorithm/breadth_first_search.hpp"
+#include "melon/algorithm/multi_source_bfs.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+#include "random_ranges_helper.hpp"
+
+using namespace fhamonic::melon;
+
+namespace {
+struct msbfs_reference_bfs_traits {
+    static constexpr bool store_pred_vertices = false;
+    static constexpr bool store_pred_arcs = false;
+    static constexpr bool store_distances = true;
+};
+
+struct msbfs_distances_traits {
+    static constexpr bool store_distances = true;
+};
+}  // namespace
+
+GTEST_TEST(multi_source_bfs, test) {
+    static_digraph_builder<static_digraph> builder(8);
+
+    builder.add_arc(0, 1)
+        .add_arc(0, 2)
+        .add_arc(0, 5)
+        .add_arc(1, 3)
+        .add_arc(2, 3)
+        .add_arc(3, 4)
+        .add_arc(5, 4)
+        .add_arc(7, 5);
+
+    auto [graph] = builder.build();
+
+    multi_source_bfs<static_digraph, 64, msbfs_distances_traits> alg(
+        graph, std::vector<unsigned>{0u, 7u, 3u});
+    ASSERT_EQ(alg.nb_sources(), 3);
+    alg.run();
+
+    const std::vector<int> expected = {0, 1, 1, 2, 2, 1};
+    for(unsigned u = 0; u < 6; ++u) {
+        ASSERT_TRUE(alg.reached(0, u));
+        ASSERT_EQ(alg.dist(0, u), expected[u]);
+    }
+    ASSERT_FALSE(alg.reached(0, 6u));
+    ASSERT_FALSE(alg.reached(0, 7u));
+    ASSERT_EQ(alg.dist(1, 4u), 2);
+    ASSERT_FALSE(alg.reached(1, 0u));
+    ASSERT_EQ(alg.dist(2, 4u), 1);
+    ASSERT_EQ(alg.reached_sources(4u).count(), 3);
+    ASSERT_EQ(alg.reached_sources(1u).count(), 1);
+
+    alg.reset();
+    alg.add_source(5u);
+    alg.run();
+    ASSERT_EQ(alg.nb_sources(), 1);
+    ASSERT_EQ(alg.dist(0, 4u), 1);
+    ASSERT_FALSE(alg.reached(0, 0u));
+}
+
+template <std::size_t B>
+void check_against_bfs(const static_digraph & graph,
+                       const std::size_t nb_sources) {
+    auto sources = random_vector<unsigned>(
+        nb_sources, 0, static_cast<unsigned>(graph.nb_vertices() - 1));
+    multi_source_bfs<static_digraph, B, msbfs_distances_traits> alg(graph,
+                                                                  sources);
+    std::size_t nb_visits = 0;
+    alg.run([&](const unsigned &, const auto & mask, int) {
+        nb_visits += mask.count();
+    });
+    std::size_t nb_reached = 0;
+    for(std::size_t i = 0; i < nb_sources; ++i) {
+        breadth_first_search<static_digraph, msbfs_reference_bfs_traits> bfs(
+            graph, sources[i]);
+        bfs.run();
+        for(auto && u : graph.vertices()) {
+            ASSERT_EQ(alg.reached(i, u), bfs.reached(u));
+            if(!bfs.reached(u)) continue;
+            ASSERT_EQ(alg.dist(i, u), bfs.dist(u));
+            ++nb_reached;
+        }
+    }
+    ASSERT_EQ(nb_visits, nb_reached);
+}
+
+GTEST_TEST(multi_source_bfs, fuzzy_test) {
+    for(int it = 0; it < 3; ++it) {
+        const std::size_t nb_vertices = 500;
+        const std::size_t nb_arcs = 1500;
+        auto sources = random_vector<unsigned>(nb_arcs, 0, nb_vertices - 1);
+        auto targets = random_vector<unsigned>(nb_arcs, 0, nb_vertices - 1);
+        static_digraph_builder<static_digraph> builder(nb_vertices);
+        for(std::size_t i = 0; i < nb_arcs; ++i)
+            builder.add_arc(sources[i], targets[i]);
+        auto [graph] = builder.build();
+
+        check_against_bfs<64>(graph, 64);
+        check_against_bfs<256>(graph, 200);
+        check_against_bfs<512>(graph, 512);
+    }
+}
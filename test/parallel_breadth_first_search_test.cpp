@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "melon/algorithm/breadth_first_search.hpp"
+#include "melon/algorithm/parallel_breadth_first_search.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+#include "random_ranges_helper.hpp"
+
+using namespace fhamonic::melon;
+
+namespace {
+struct bfs_distances_traits {
+    static constexpr bool store_pred_vertices = true;
+    static constexpr bool store_pred_arcs = false;
+    static constexpr bool store_distances = true;
+};
+
+struct parallel_bfs_traits {
+    static constexpr bool store_pred_vertices = true;
+    static constexpr bool store_pred_arcs = true;
+    static constexpr bool store_distances = true;
+};
+}  // namespace
+
+GTEST_TEST(parallel_breadth_first_search, test) {
+    static_digraph_builder<static_digraph> builder(8);
+
+    builder.add_arc(0, 1)
+        .add_arc(0, 2)
+        .add_arc(0, 5)
+        .add_arc(1, 3)
+        .add_arc(2, 3)
+        .add_arc(3, 4)
+        .add_arc(5, 4)
+        .add_arc(7, 5);
+
+    auto [graph] = builder.build();
+
+    parallel_breadth_first_search<static_digraph, parallel_bfs_traits> alg(
+        graph, 0u, parallel_policy{2});
+    alg.run();
+    const std::vector<int> expected = {0, 1, 1, 2, 2, 1};
+    for(unsigned u = 0; u < 6; ++u) {
+        ASSERT_TRUE(alg.reached(u));
+        ASSERT_EQ(alg.dist(u), expected[u]);
+    }
+    ASSERT_EQ(alg.pred_vertex(4u), 5u);
+    ASSERT_FALSE(alg.reached(6u));
+    ASSERT_FALSE(alg.reached(7u));
+
+    alg.reset();
+    alg.add_source(7u);
+    alg.run();
+    ASSERT_EQ(alg.dist(4u), 2);
+    ASSERT_FALSE(alg.reached(0u));
+}
+
+GTEST_TEST(parallel_breadth_first_search, fuzzy_test) {
+    for(int it = 0; it < 5; ++it) {
+        const std::size_t nb_vertices = 2000;
+        const std::size_t nb_arcs = 10000;
+        auto sources = random_vector<unsigned>(nb_arcs, 0, nb_vertices - 1);
+        auto targets = random_vector<unsigned>(nb_arcs, 0, nb_vertices - 1);
+        static_digraph_builder<static_digraph> builder(nb_vertices);
+        for(std::size_t i = 0; i < nb_arcs; ++i)
+            builder.add_arc(sources[i], targets[i]);
+        auto [graph] = builder.build();
+
+        breadth_first_search<static_digraph, bfs_distances_traits> bfs(graph,
+                                                                       0u);
+        bfs.run();
+        for(std::size_t nb_threads : {1u, 3u, 4u}) {
+            parallel_breadth_first_search<static_digraph, parallel_bfs_traits>
+                alg(graph, 0u, parallel_policy{nb_threads});
+            alg.run();
+            for(auto && u : graph.vertices()) {
+                ASSERT_EQ(alg.reached(u), bfs.reached(u));
+                if(!bfs.reached(u) || u == 0u) continue;
+                ASSERT_EQ(alg.dist(u), bfs.dist(u));
+                ASSERT_EQ(alg.dist(alg.pred_vertex(u)) + 1, alg.dist(u));
+                ASSERT_EQ(graph.arc_source(alg.pred_arc(u)),
+                          alg.pred_vertex(u));
+                ASSERT_EQ(graph.arc_target(alg.pred_arc(u)), u);
+            }
+        }
+    }
+}
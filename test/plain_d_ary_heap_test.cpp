@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <vector>
+
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/view/zip.hpp>
+
+#include "melon/container/plain_d_ary_heap.hpp"
+#include "melon/utility/priority_queue.hpp"
+
+#include "random_ranges_helper.hpp"
+#include "ranges_test_helper.hpp"
+
+using namespace fhamonic::melon;
+
+static_assert(priority_queue<plain_d_ary_heap<2, std::size_t, int>>);
+static_assert(!updatable_priority_queue<plain_d_ary_heap<2, std::size_t, int>>);
+
+GTEST_TEST(plain_d_ary_heap, duplicate_keys_test) {
+    plain_d_ary_heap<2, std::size_t, int> heap;
+    heap.push(0ul, 3);
+    heap.push(1ul, 7);
+    heap.push(0ul, 9);
+    ASSERT_EQ(heap.size(), 3);
+    ASSERT_EQ(heap.top(), std::make_pair(0ul, 9));
+    heap.pop();
+    ASSERT_EQ(heap.top(), std::make_pair(1ul, 7));
+    heap.pop();
+    ASSERT_EQ(heap.top(), std::make_pair(0ul, 3));
+    heap.pop();
+    ASSERT_TRUE(heap.empty());
+}
+
+namespace {
+template <int D>
+void fuzzy_push_pop_test() {
+    for(int it = 0; it < 10; ++it) {
+        std::size_t size = 127;
+        std::vector<int> datas = random_vector_all_diff(size, 0, 1000);
+        std::vector<std::size_t> permuted_id(size);
+        std::iota(permuted_id.begin(), permuted_id.end(), 0);
+        auto zip_view = ranges::view::zip(datas, permuted_id);
+
+        plain_d_ary_heap<D, std::size_t, int> heap;
+        for(std::size_t i = 0; i < size; ++i) {
+            heap.push(i, datas[i]);
+        }
+
+        ranges::sort(zip_view,
+                     [](auto p1, auto p2) { return p1.first > p2.first; });
+        for(std::size_t i = 0; i < size; ++i) {
+            ASSERT_FALSE(heap.empty());
+            ASSERT_EQ(heap.top(), std::make_pair(permuted_id[i], datas[i]));
+            heap.pop();
+        }
+        ASSERT_TRUE(heap.empty());
+    }
+}
+}  // namespace
+
+GTEST_TEST(plain_d_ary_heap, 2_heap_fuzzy_push_pop_test) {
+    fuzzy_push_pop_test<2>();
+}
+GTEST_TEST(plain_d_ary_heap, 4_heap_fuzzy_push_pop_test) {
+    fuzzy_push_pop_test<4>();
+}
+GTEST_TEST(plain_d_ary_heap, 5_heap_fuzzy_push_pop_test) {
+    fuzzy_push_pop_test<5>();
+}
@@ -0,0 +1,35 @@
+#ifndef RANDOM_GRID_HELPER_HPP
+#define RANDOM_GRID_HELPER_HPP
+
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+#include "random_ranges_helper.hpp"
+
+// Bidirected width x height grid, vertex y * width + x being in row y and
+// column x, whose arcs have random values in [min_value, max_value].
+// Returns the built static_digraph and its arc values.
+template <typename T>
+auto random_grid(const unsigned width, const unsigned height,
+                 const T min_value, const T max_value) {
+    using namespace fhamonic::melon;
+    static_digraph_builder<static_digraph, T> builder(width * height);
+    auto values = random_vector<T>(4 * width * height, min_value, max_value);
+    std::size_t i = 0;
+    for(unsigned y = 0; y < height; ++y) {
+        for(unsigned x = 0; x < width; ++x) {
+            const unsigned u = y * width + x;
+            if(x + 1 < width) {
+                builder.add_arc(u, u + 1, values[i++]);
+                builder.add_arc(u + 1, u, values[i++]);
+            }
+            if(y + 1 < height) {
+                builder.add_arc(u, u + width, values[i++]);
+                builder.add_arc(u + width, u, values[i++]);
+            }
+        }
+    }
+    return builder.build();
+}
+
+#endif  // RANDOM_GRID_HELPER_HPP
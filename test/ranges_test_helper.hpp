@@ -56,8 +56,10 @@ testing::AssertionResult EMPTY(R && r) {
 
 template <typename R1, typename R2>
 testing::AssertionResult EQ_RANGES(R1 && r1, R2 && r2) {
-    const auto r1_size = std::ranges::distance(r1);
-    const auto r2_size = std::ranges::distance(r2);
+    const auto r1_size =
+        static_cast<std::ptrdiff_t>(std::ranges::distance(r1));
+    const auto r2_size =
+        static_cast<std::ptrdiff_t>(std::ranges::distance(r2));
     if(r1_size != r2_size) {
         return ::testing::AssertionFailure()
                << "ranges sizes differ: " << r1_size << " != " << r2_size;
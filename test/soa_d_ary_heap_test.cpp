@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <optional>
+#include <vector>
+
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/view/zip.hpp>
+
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/container/soa_d_ary_heap.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/priority_queue.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+#include "random_ranges_helper.hpp"
+#include "ranges_test_helper.hpp"
+
+using namespace fhamonic::melon;
+
+static_assert(updatable_priority_queue<soa_d_ary_heap<4, std::size_t, int>>);
+
+namespace {
+template <int D>
+void fuzzy_push_pop_test() {
+    for(int it = 0; it < 10; ++it) {
+        std::size_t size = 127;
+        std::vector<int> datas = random_vector_all_diff(size, 0, 1000);
+        std::vector<std::size_t> permuted_id(size);
+        std::iota(permuted_id.begin(), permuted_id.end(), 0);
+        auto zip_view = ranges::view::zip(datas, permuted_id);
+
+        soa_d_ary_heap<D, std::size_t, int> heap;
+        for(std::size_t i = 0; i < size; ++i) {
+            heap.push(i, datas[i]);
+        }
+
+        ranges::sort(zip_view,
+                     [](auto p1, auto p2) { return p1.first > p2.first; });
+        for(std::size_t i = 0; i < size; ++i) {
+            ASSERT_FALSE(heap.empty());
+            ASSERT_EQ(heap.top(), std::make_pair(permuted_id[i], datas[i]));
+            heap.pop();
+        }
+        ASSERT_TRUE(heap.empty());
+    }
+}
+}  // namespace
+
+GTEST_TEST(soa_d_ary_heap, 2_heap_fuzzy_push_pop_test) {
+    fuzzy_push_pop_test<2>();
+}
+GTEST_TEST(soa_d_ary_heap, 3_heap_fuzzy_push_pop_test) {
+    fuzzy_push_pop_test<3>();
+}
+GTEST_TEST(soa_d_ary_heap, 4_heap_fuzzy_push_pop_test) {
+    fuzzy_push_pop_test<4>();
+}
+GTEST_TEST(soa_d_ary_heap, 8_heap_fuzzy_push_pop_test) {
+    fuzzy_push_pop_test<8>();
+}
+GTEST_TEST(soa_d_ary_heap, 16_heap_fuzzy_push_pop_test) {
+    fuzzy_push_pop_test<16>();
+}
+
+namespace {
+// priorities with duplicates, half of them promoted before popping, on the
+// arities and types covered by the SSE4.1/AVX2 minimum child when available
+template <int D, typename P, typename C>
+void fuzzy_promote_pop_test() {
+    for(int it = 0; it < 10; ++it) {
+        const std::size_t size = 300;
+        std::vector<int> datas = random_vector<int>(size, 0, 100);
+        std::vector<P> priorities(size);
+        soa_d_ary_heap<D, std::size_t, P, C> heap;
+        for(std::size_t i = 0; i < size; ++i) {
+            priorities[i] = static_cast<P>(datas[i]);
+            heap.push(i, priorities[i]);
+        }
+        for(std::size_t i = 0; i < size; i += 2) {
+            const P p = C{}(P(0), P(1)) ? P(0) : P(101);
+            if(C{}(p, priorities[i])) {
+                priorities[i] = p;
+                heap.promote(i, p);
+            }
+        }
+        std::vector<P> sorted_priorities = priorities;
+        std::ranges::sort(sorted_priorities, C{});
+        for(std::size_t i = 0; i < size; ++i) {
+            ASSERT_FALSE(heap.empty());
+            const auto [k, p] = heap.top();
+            ASSERT_EQ(p, sorted_priorities[i]);
+            ASSERT_EQ(p, priorities[k]);
+            heap.pop();
+        }
+        ASSERT_TRUE(heap.empty());
+    }
+}
+}  // namespace
+
+GTEST_TEST(soa_d_ary_heap, fuzzy_promote_pop_test) {
+    fuzzy_promote_pop_test<4, int, std::less<int>>();
+    fuzzy_promote_pop_test<8, int, std::greater<int>>();
+    fuzzy_promote_pop_test<16, int, std::less<int>>();
+    fuzzy_promote_pop_test<8, unsigned, std::less<unsigned>>();
+    fuzzy_promote_pop_test<4, unsigned, std::greater<>>();
+    fuzzy_promote_pop_test<8, float, std::less<float>>();
+    fuzzy_promote_pop_test<16, float, std::greater<float>>();
+    fuzzy_promote_pop_test<2, double, std::less<>>();
+    fuzzy_promote_pop_test<4, double, std::greater<double>>();
+    fuzzy_promote_pop_test<8, double, std::less<double>>();
+    fuzzy_promote_pop_test<3, float, std::less<float>>();
+}
+
+GTEST_TEST(soa_d_ary_heap, 4_heap_promote_test) {
+    std::vector<int> datas = {0, 7, 3, 5, 6, 11};
+    soa_d_ary_heap<4, std::size_t, int> heap;
+    for(std::size_t i = 0; i < datas.size(); ++i) {
+        heap.push(i, datas[i]);
+    }
+    ASSERT_TRUE(heap.contains(3ul));
+    heap.promote(3ul, 8);
+    ASSERT_EQ(heap.priority(3ul), 8);
+
+    ASSERT_FALSE(heap.empty());
+    ASSERT_EQ(heap.top(), std::make_pair(5ul, 11));
+    heap.pop();
+    ASSERT_FALSE(heap.empty());
+    ASSERT_EQ(heap.top(), std::make_pair(3ul, 8));
+    heap.pop();
+    ASSERT_FALSE(heap.contains(3ul));
+
+    heap.promote(0ul, 9);
+
+    ASSERT_FALSE(heap.empty());
+    ASSERT_EQ(heap.top(), std::make_pair(0ul, 9));
+    heap.pop();
+    ASSERT_FALSE(heap.empty());
+    ASSERT_EQ(heap.top(), std::make_pair(1ul, 7));
+    heap.pop();
+    ASSERT_FALSE(heap.empty());
+    ASSERT_EQ(heap.top(), std::make_pair(4ul, 6));
+    heap.pop();
+    ASSERT_FALSE(heap.empty());
+    ASSERT_EQ(heap.top(), std::make_pair(2ul, 3));
+    heap.pop();
+    ASSERT_TRUE(heap.empty());
+}
+
+template <typename G, typename L>
+struct soa_heap_dijkstra_traits : public dijkstra_default_traits<G, L> {
+    using semiring = shortest_path_semiring<mapped_value_t<L, arc_t<G>>>;
+    struct priority_cmp {
+        [[nodiscard]] constexpr bool operator()(
+            const auto & p1, const auto & p2) const noexcept {
+            return semiring::less(p1, p2);
+        }
+    };
+    using heap = soa_d_ary_heap<8, vertex_t<G>, mapped_value_t<L, arc_t<G>>,
+                                priority_cmp, vertex_map_t<G, std::size_t>>;
+};
+
+GTEST_TEST(soa_d_ary_heap, dijkstra_test) {
+    const std::size_t nb_vertices = 200;
+    const std::size_t nb_arcs = 2000;
+    auto sources = random_vector<unsigned>(nb_arcs, 0, nb_vertices - 1);
+    auto targets = random_vector<unsigned>(nb_arcs, 0, nb_vertices - 1);
+    auto lengths = random_vector<unsigned>(nb_arcs, 0, 1000);
+
+    static_digraph_builder<static_digraph, unsigned> builder(nb_vertices);
+    for(std::size_t i = 0; i < nb_arcs; ++i)
+        builder.add_arc(sources[i], targets[i], lengths[i]);
+    auto [graph, length_map] = builder.build();
+
+    using length_map_t = decltype(length_map);
+    dijkstra<static_digraph, length_map_t,
+             soa_heap_dijkstra_traits<static_digraph, length_map_t>>
+        alg(graph, length_map);
+    std::vector<std::optional<unsigned>> expected(nb_vertices);
+    for(auto && [u, dist] : dijkstra(graph, length_map, 0u)) expected[u] = dist;
+
+    alg.add_source(0u);
+    std::size_t nb_reached = 0;
+    for(auto && [u, dist] : alg) {
+        ASSERT_EQ(expected[u], dist);
+        ++nb_reached;
+    }
+    ASSERT_EQ(nb_reached, std::ranges::count_if(
+                              expected, [](auto && d) { return d.has_value(); }));
+}
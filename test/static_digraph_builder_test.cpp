@@ -3,6 +3,7 @@
 #include "melon/container/static_digraph.hpp"
 #include "melon/utility/static_digraph_builder.hpp"
 
+#include "random_ranges_helper.hpp"
 #include "ranges_test_helper.hpp"
 
 using namespace fhamonic::melon;
@@ -75,3 +76,79 @@ GTEST_TEST(static_digraph_builder, build_with_map) {
         ASSERT_EQ(map[a], weight(u, v));
     }
 }
+
+GTEST_TEST(static_digraph_builder, build_with_custom_index_widths) {
+    using G = basic_static_digraph<std::uint16_t, std::uint64_t>;
+    static_digraph_builder<G, int> builder(8);
+
+    builder.add_arc(3, 4, 34)
+        .add_arc(1, 7, 17)
+        .add_arc(5, 2, 52)
+        .add_arc(2, 4, 24)
+        .add_arc(1, 2, 12);
+
+    auto [graph, map] = builder.build();
+    static_assert(std::same_as<decltype(graph), G>);
+
+    ASSERT_TRUE(EQ_RANGES(
+        arcs_entries(graph),
+        std::vector<std::pair<arc_t<G>, std::pair<vertex_t<G>, vertex_t<G>>>>(
+            {{0, {1, 2}}, {1, {1, 7}}, {2, {2, 4}}, {3, {3, 4}}, {4, {5, 2}}})));
+    ASSERT_TRUE(EQ_RANGES(map, {12, 17, 24, 34, 52}));
+}
+
+GTEST_TEST(static_digraph_builder, parallel_build) {
+    constexpr std::size_t n = 50;
+    static_digraph_builder<static_digraph, int> builder(n);
+    static_digraph_builder<static_digraph, int> parallel_builder(n);
+
+    auto sources = random_vector<vertex_t<static_digraph>>(1000, 0, n - 1);
+    auto targets = random_vector<vertex_t<static_digraph>>(1000, 0, n - 1);
+    for(std::size_t i = 0; i < sources.size(); ++i) {
+        const int weight = static_cast<int>(sources[i] * n + targets[i]);
+        builder.add_arc(sources[i], targets[i], weight);
+        parallel_builder.add_arc(sources[i], targets[i], weight);
+    }
+
+    auto unsorted_builder = builder;
+    auto parallel_unsorted_builder = builder;
+
+    auto [graph, map] = builder.build();
+    auto [parallel_graph, parallel_map] =
+        parallel_builder.build(parallel_policy{4});
+
+    ASSERT_TRUE(EQ_RANGES(arcs_entries(parallel_graph), arcs_entries(graph)));
+    for(auto && u : vertices(graph))
+        ASSERT_TRUE(EQ_RANGES(in_arcs(parallel_graph, u), in_arcs(graph, u)));
+    ASSERT_TRUE(EQ_RANGES(parallel_map, map));
+
+    auto [unsorted_graph, unsorted_map] = unsorted_builder.build(false);
+    auto [parallel_unsorted_graph, parallel_unsorted_map] =
+        parallel_unsorted_builder.build(parallel_policy{4}, false);
+    ASSERT_TRUE(EQ_RANGES(arcs_entries(parallel_unsorted_graph),
+                          arcs_entries(unsorted_graph)));
+    ASSERT_TRUE(EQ_RANGES(parallel_unsorted_map, unsorted_map));
+}
+
+GTEST_TEST(static_digraph_builder, build_keeps_insertion_order) {
+    static_digraph_builder<static_digraph, int> builder(4);
+
+    builder.add_arc(2, 3, 0)
+        .add_arc(0, 1, 1)
+        .add_arc(2, 1, 2)
+        .add_arc(0, 1, 3)
+        .add_arc(2, 3, 4)
+        .add_arc(0, 2, 5);
+
+    static_digraph_builder<static_digraph, int> unsorted_builder = builder;
+
+    auto [graph, map] = builder.build();
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(graph, 0), {1, 1, 2}));
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(graph, 2), {1, 3, 3}));
+    ASSERT_TRUE(EQ_RANGES(map, {1, 3, 5, 2, 0, 4}));
+
+    auto [unsorted_graph, unsorted_map] = unsorted_builder.build(false);
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(unsorted_graph, 0), {1, 1, 2}));
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(unsorted_graph, 2), {3, 1, 3}));
+    ASSERT_TRUE(EQ_RANGES(unsorted_map, {1, 3, 5, 0, 2, 4}));
+}
@@ -3,6 +3,7 @@
 #include "melon/graph.hpp"
 #include "melon/container/static_digraph.hpp"
 
+#include "random_ranges_helper.hpp"
 #include "ranges_test_helper.hpp"
 
 using namespace fhamonic;
@@ -135,3 +136,65 @@ GTEST_TEST(static_digraph, vectors_constructor_2) {
         ASSERT_EQ(arc_target(graph,a), arc_pairs[a].second.second);
     }
 }
+
+using small_static_digraph = basic_static_digraph<std::uint16_t, std::uint16_t>;
+using large_static_digraph = basic_static_digraph<std::uint32_t, std::uint64_t>;
+
+static_assert(std::same_as<vertex_t<small_static_digraph>, std::uint16_t>);
+static_assert(std::same_as<arc_t<large_static_digraph>, std::uint64_t>);
+static_assert(melon::outward_incidence_graph<small_static_digraph>);
+static_assert(melon::inward_adjacency_graph<small_static_digraph>);
+static_assert(melon::outward_incidence_graph<large_static_digraph>);
+static_assert(melon::inward_adjacency_graph<large_static_digraph>);
+static_assert(std::same_as<vertex_map_t<large_static_digraph, int>,
+                           static_map<std::uint32_t, int>>);
+static_assert(std::same_as<arc_map_t<large_static_digraph, int>,
+                           static_map<std::uint64_t, int>>);
+
+GTEST_TEST(static_digraph, custom_index_widths) {
+    std::vector<std::uint16_t> small_sources = {1, 1, 1, 2, 2, 3, 5, 5, 6};
+    std::vector<std::uint16_t> small_targets = {2, 6, 7, 3, 4, 4, 2, 3, 5};
+    small_static_digraph small_graph(8, small_sources, small_targets);
+
+    std::vector<std::uint32_t> large_sources(small_sources.begin(),
+                                             small_sources.end());
+    std::vector<std::uint32_t> large_targets(small_targets.begin(),
+                                             small_targets.end());
+    large_static_digraph large_graph(8, large_sources, large_targets);
+
+    ASSERT_EQ(nb_vertices(small_graph), 8);
+    ASSERT_EQ(nb_arcs(small_graph), 9);
+    ASSERT_EQ(nb_vertices(large_graph), 8);
+    ASSERT_EQ(nb_arcs(large_graph), 9);
+    for(auto && u : vertices(small_graph)) {
+        ASSERT_TRUE(EQ_RANGES(out_arcs(small_graph, u),
+                              out_arcs(large_graph, u)));
+        ASSERT_TRUE(EQ_RANGES(in_arcs(small_graph, u),
+                              in_arcs(large_graph, u)));
+        ASSERT_TRUE(EQ_RANGES(out_neighbors(small_graph, u),
+                              out_neighbors(large_graph, u)));
+    }
+    ASSERT_TRUE(EMPTY(out_neighbors(small_graph, 7)));
+    ASSERT_TRUE(EQ_MULTISETS(in_neighbors(small_graph, 4), {2, 3}));
+}
+
+GTEST_TEST(static_digraph, parallel_constructor) {
+    auto sources = random_vector<vertex_t<static_digraph>>(2000, 0, 99);
+    auto targets = random_vector<vertex_t<static_digraph>>(2000, 0, 99);
+    std::ranges::sort(sources);
+    static_digraph graph(120, sources, targets);
+    static_digraph parallel_graph(parallel_policy{4}, 120, sources, targets);
+
+    ASSERT_EQ(nb_vertices(parallel_graph), 120);
+    ASSERT_EQ(nb_arcs(parallel_graph), 2000);
+    for(auto && u : vertices(graph)) {
+        ASSERT_TRUE(EQ_RANGES(out_arcs(parallel_graph, u), out_arcs(graph, u)));
+        ASSERT_TRUE(EQ_RANGES(in_arcs(parallel_graph, u), in_arcs(graph, u)));
+    }
+    ASSERT_TRUE(EQ_RANGES(arcs_entries(parallel_graph), arcs_entries(graph)));
+
+    static_digraph empty_graph(par, 0, std::vector<vertex_t<static_digraph>>{},
+                               std::vector<vertex_t<static_digraph>>{});
+    ASSERT_EQ(nb_vertices(empty_graph), 0);
+    ASSERT_EQ(nb_arcs(empty_graph), 0);
+}
@@ -123,4 +123,37 @@ GTEST_TEST(static_forward_digraph, vectors_constructor_2) {
                   std::ranges::empty_view<vertex_t<static_forward_digraph>>()));
 
     ASSERT_TRUE(EQ_RANGES(arcs_entries(graph), arc_pairs));
-}
\ No newline at end of file
+}
+using small_static_forward_digraph =
+    basic_static_forward_digraph<std::uint16_t, std::uint16_t>;
+static_assert(melon::outward_adjacency_graph<small_static_forward_digraph>);
+static_assert(std::same_as<vertex_t<small_static_forward_digraph>,
+                           std::uint16_t>);
+
+GTEST_TEST(static_forward_digraph, custom_index_widths) {
+    std::vector<std::uint16_t> sources = {1, 1, 1, 2, 2, 3, 5, 5, 6};
+    std::vector<std::uint16_t> targets = {2, 6, 7, 3, 4, 4, 2, 3, 5};
+    small_static_forward_digraph graph(8, sources, targets);
+
+    ASSERT_EQ(nb_vertices(graph), 8);
+    ASSERT_EQ(nb_arcs(graph), 9);
+    ASSERT_TRUE(EMPTY(out_neighbors(graph, 0)));
+    ASSERT_TRUE(EQ_MULTISETS(out_neighbors(graph, 1), {2, 6, 7}));
+    ASSERT_TRUE(EQ_MULTISETS(out_arcs(graph, 5), {6, 7}));
+    ASSERT_TRUE(EMPTY(out_neighbors(graph, 7)));
+}
+
+GTEST_TEST(static_forward_digraph, parallel_constructor) {
+    std::vector<vertex_t<static_forward_digraph>> sources = {1, 1, 1, 2, 2,
+                                                             3, 5, 5, 6};
+    std::vector<vertex_t<static_forward_digraph>> targets = {2, 6, 7, 3, 4,
+                                                             4, 2, 3, 5};
+    static_forward_digraph graph(8, sources, targets);
+    static_forward_digraph parallel_graph(parallel_policy{3}, 8, sources,
+                                          targets);
+
+    ASSERT_EQ(nb_vertices(parallel_graph), 8);
+    ASSERT_EQ(nb_arcs(parallel_graph), 9);
+    for(auto && u : vertices(graph))
+        ASSERT_TRUE(EQ_RANGES(out_arcs(parallel_graph, u), out_arcs(graph, u)));
+}
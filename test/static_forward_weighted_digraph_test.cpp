@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/container/static_forward_weighted_digraph.hpp"
+#include "melon/graph.hpp"
+
+#include "ranges_test_helper.hpp"
+
+using namespace fhamonic;
+using namespace fhamonic::melon;
+
+using G = static_forward_weighted_digraph<int>;
+using L = G::arc_weights_map_type;
+
+static_assert(melon::graph<G>);
+static_assert(melon::outward_incidence_graph<G>);
+static_assert(melon::outward_adjacency_graph<G>);
+static_assert(melon::has_vertex_map<G>);
+static_assert(melon::has_arc_map<G>);
+static_assert(melon::input_value_map<L, arc_t<G>>);
+static_assert(melon::outward_weighted_adjacency_graph<G, L>);
+static_assert(!melon::outward_weighted_adjacency_graph<G, std::vector<int>>);
+
+struct store_all_traits : dijkstra_default_traits<G, L> {
+    static constexpr bool store_distances = true;
+    static constexpr bool store_paths = true;
+};
+
+GTEST_TEST(static_forward_weighted_digraph, empty_constructor) {
+    G graph;
+    ASSERT_EQ(nb_vertices(graph), 0);
+    ASSERT_EQ(nb_arcs(graph), 0);
+    ASSERT_TRUE(EMPTY(vertices(graph)));
+    ASSERT_TRUE(EMPTY(arcs(graph)));
+
+    ASSERT_FALSE(is_valid_vertex(graph, 0));
+    ASSERT_FALSE(is_valid_arc(graph, 0));
+}
+
+GTEST_TEST(static_forward_weighted_digraph, vectors_constructor) {
+    std::vector<unsigned int> sources = {1, 1, 1, 2, 2, 3, 5, 5, 6};
+    std::vector<unsigned int> targets = {2, 6, 7, 3, 4, 4, 2, 3, 5};
+    std::vector<int> weights = {12, 16, 17, 23, 24, 34, 52, 53, 65};
+    G graph(8, sources, targets, weights);
+
+    ASSERT_EQ(nb_vertices(graph), 8);
+    ASSERT_EQ(nb_arcs(graph), 9);
+    ASSERT_TRUE(EMPTY(out_neighbors(graph, 0)));
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(graph, 1), {2, 6, 7}));
+    ASSERT_TRUE(EQ_RANGES(out_arcs(graph, 5), {6, 7}));
+    ASSERT_TRUE(EMPTY(out_neighbors(graph, 7)));
+
+    auto weights_map = graph.arc_weights_map();
+    for(auto && a : arcs(graph)) {
+        ASSERT_EQ(arc_target(graph, a), targets[a]);
+        ASSERT_EQ(graph.arc_weight(a), weights[a]);
+        ASSERT_EQ(weights_map[a], weights[a]);
+    }
+    for(auto && u : vertices(graph)) {
+        auto a = *out_arcs(graph, u).begin();
+        for(auto && [w, weight] : graph.out_weighted_neighbors(u)) {
+            ASSERT_EQ(w, arc_target(graph, a));
+            ASSERT_EQ(weight, weights[a]);
+            ++a;
+        }
+    }
+}
+
+GTEST_TEST(static_forward_weighted_digraph, dijkstra) {
+    std::vector<unsigned int> sources = {0, 0, 0, 1, 1, 1, 2, 2, 2,
+                                         2, 3, 3, 3, 4, 4, 5, 5, 5};
+    std::vector<unsigned int> targets = {1, 2, 5, 0, 2, 3, 0, 1, 3,
+                                         5, 1, 2, 4, 3, 5, 0, 2, 4};
+    std::vector<int> lengths = {7,  9,  14, 7, 10, 15, 9, 10, 12,
+                                2,  15, 12, 6, 6,  9,  14, 2, 9};
+    G graph(6, sources, targets, lengths);
+    auto length_map = graph.arc_weights_map();
+
+    dijkstra<G, L, store_all_traits> alg(graph, length_map);
+    alg.add_source(0);
+
+    std::vector traversal = {std::make_pair(0u, 0),  std::make_pair(1u, 7),
+                             std::make_pair(2u, 9),  std::make_pair(5u, 11),
+                             std::make_pair(4u, 20), std::make_pair(3u, 21)};
+    for(auto && entry : traversal) {
+        ASSERT_FALSE(alg.finished());
+        ASSERT_EQ(alg.current(), entry);
+        alg.advance();
+    }
+    ASSERT_TRUE(alg.finished());
+
+    ASSERT_EQ(alg.dist(4), 20);
+    ASSERT_EQ(alg.pred_vertex(4), 5u);
+    ASSERT_EQ(alg.pred_vertex(5), 2u);
+    ASSERT_EQ(arc_target(graph, alg.pred_arc(3)), 3u);
+    ASSERT_EQ(lengths[alg.pred_arc(3)], 12);
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "melon/algorithm/breadth_first_search.hpp"
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/algorithm/edmonds_karp.hpp"
+#include "melon/container/static_graph.hpp"
+#include "melon/graph.hpp"
+
+#include "ranges_test_helper.hpp"
+
+using namespace fhamonic;
+using namespace fhamonic::melon;
+
+static_assert(melon::graph<static_graph>);
+static_assert(melon::outward_incidence_graph<static_graph>);
+static_assert(melon::outward_adjacency_graph<static_graph>);
+static_assert(melon::inward_incidence_graph<static_graph>);
+static_assert(melon::inward_adjacency_graph<static_graph>);
+static_assert(melon::has_vertex_map<static_graph>);
+static_assert(melon::has_arc_map<static_graph>);
+
+GTEST_TEST(static_graph, empty_constructor) {
+    static_graph graph;
+    ASSERT_EQ(nb_vertices(graph), 0);
+    ASSERT_EQ(nb_arcs(graph), 0);
+    ASSERT_EQ(graph.nb_edges(), 0);
+    ASSERT_TRUE(EMPTY(vertices(graph)));
+    ASSERT_TRUE(EMPTY(arcs(graph)));
+
+    ASSERT_FALSE(is_valid_vertex(graph, 0));
+    ASSERT_FALSE(is_valid_arc(graph, 0));
+
+    EXPECT_DEATH((void)out_arcs(graph, 0), "");
+    EXPECT_DEATH((void)arc_target(graph, 0), "");
+}
+
+GTEST_TEST(static_graph, vectors_constructor) {
+    std::vector<vertex_t<static_graph>> sources = {2, 0, 1, 3};
+    std::vector<vertex_t<static_graph>> targets = {0, 1, 2, 3};
+
+    static_graph graph(4, sources, targets);
+    ASSERT_EQ(nb_vertices(graph), 4);
+    ASSERT_EQ(graph.nb_edges(), 4);
+    ASSERT_EQ(nb_arcs(graph), 8);
+    ASSERT_TRUE(EQ_RANGES(graph.edges(), {0, 1, 2, 3}));
+
+    for(auto && a : arcs(graph)) {
+        const auto e = static_graph::arc_edge(a);
+        ASSERT_EQ(arc_source(graph, a), (a % 2 == 0 ? sources : targets)[e]);
+        ASSERT_EQ(arc_target(graph, a), (a % 2 == 0 ? targets : sources)[e]);
+    }
+
+    ASSERT_TRUE(EQ_RANGES(out_arcs(graph, 0), {1, 2}));
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(graph, 0), {2, 1}));
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(graph, 1), {0, 2}));
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(graph, 2), {0, 1}));
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(graph, 3), {3, 3}));
+    ASSERT_TRUE(EQ_RANGES(in_arcs(graph, 0), {0, 3}));
+    ASSERT_TRUE(EQ_RANGES(in_neighbors(graph, 0), {2, 1}));
+}
+
+GTEST_TEST(static_graph, edge_map) {
+    std::vector<vertex_t<static_graph>> sources = {0, 1};
+    std::vector<vertex_t<static_graph>> targets = {1, 2};
+    static_graph graph(3, sources, targets);
+
+    auto weights = graph.create_edge_map<int>(0);
+    ASSERT_EQ(weights.size(), 2);
+    weights[3] = 5;
+    ASSERT_EQ(weights[2], 5);
+    ASSERT_EQ(weights.edge_values()[1], 5);
+    ASSERT_EQ(weights[0], 0);
+}
+
+GTEST_TEST(static_graph, breadth_first_search) {
+    std::vector<vertex_t<static_graph>> sources = {1, 2, 4};
+    std::vector<vertex_t<static_graph>> targets = {0, 1, 3};
+    static_graph graph(5, sources, targets);
+
+    std::vector<vertex_t<static_graph>> traversal;
+    for(auto && u : breadth_first_search(graph, 2u)) traversal.push_back(u);
+    ASSERT_EQ(traversal, (std::vector<vertex_t<static_graph>>{2, 1, 0}));
+}
+
+GTEST_TEST(static_graph, dijkstra) {
+    std::vector<vertex_t<static_graph>> sources = {0, 0, 0, 1, 1, 2, 2, 3, 4};
+    std::vector<vertex_t<static_graph>> targets = {1, 2, 5, 2, 3, 3, 5, 4, 5};
+    static_graph graph(6, sources, targets);
+    static_edge_map<arc_t<static_graph>, int> lengths(
+        std::vector<int>{7, 9, 14, 10, 15, 11, 2, 6, 9});
+
+    std::vector<std::pair<vertex_t<static_graph>, int>> distances;
+    for(auto && [u, dist] : dijkstra(graph, lengths, 3u))
+        distances.emplace_back(u, dist);
+    ASSERT_EQ(distances, (std::vector<std::pair<vertex_t<static_graph>, int>>{
+                             {3, 0}, {4, 6}, {2, 11}, {5, 13}, {1, 15}, {0, 20}}));
+}
+
+GTEST_TEST(static_graph, edmonds_karp) {
+    std::vector<vertex_t<static_graph>> sources = {0, 0, 1, 2, 1, 3};
+    std::vector<vertex_t<static_graph>> targets = {1, 2, 2, 3, 3, 4};
+    static_graph graph(5, sources, targets);
+    static_edge_map<arc_t<static_graph>, int> capacities(
+        std::vector<int>{3, 2, 4, 2, 1, 10});
+
+    edmonds_karp alg(graph, capacities, 0u, 4u);
+    ASSERT_EQ(alg.run().flow_value(), 3);
+}
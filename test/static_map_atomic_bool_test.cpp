@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "melon/container/static_map.hpp"
+
+using namespace fhamonic::melon;
+
+using atomic_bool_map = static_map<std::size_t, std::atomic<bool>>;
+
+static_assert(std::copyable<atomic_bool_map>);
+static_assert(std::ranges::random_access_range<atomic_bool_map>);
+
+GTEST_TEST(static_map_atomic_bool, size_init_constructor) {
+    atomic_bool_map map(0, false);
+    ASSERT_EQ(map.size(), 0);
+    ASSERT_EQ(map.begin(), map.end());
+
+    atomic_bool_map map2(130, true);
+    ASSERT_EQ(map2.size(), 130);
+    ASSERT_TRUE(std::ranges::all_of(std::views::values(map2),
+                                    [](const bool b) { return b; }));
+
+    atomic_bool_map map3(130, false);
+    ASSERT_TRUE(std::ranges::none_of(std::views::values(map3),
+                                     [](const bool b) { return b; }));
+}
+
+GTEST_TEST(static_map_atomic_bool, accessor_extensive_write_and_read) {
+    const std::size_t nb_bools = 153;
+    std::vector<bool> datas(nb_bools);
+    atomic_bool_map map(nb_bools, false);
+
+    auto gen = std::bind(std::uniform_int_distribution<>(0, 1),
+                         std::default_random_engine());
+
+    for(std::size_t i = 0; i < nb_bools; ++i) {
+        bool b = gen();
+        datas[i] = b;
+        map[i] = b;
+    }
+    for(std::size_t i = 0; i < nb_bools; ++i) {
+        ASSERT_EQ(datas[i], map[i]);
+        ASSERT_EQ(datas[i], std::as_const(map)[i]);
+    }
+    ASSERT_TRUE(std::ranges::equal(std::views::values(map), datas));
+
+    atomic_bool_map copy(map);
+    ASSERT_TRUE(std::ranges::equal(std::views::values(copy), datas));
+}
+
+GTEST_TEST(static_map_atomic_bool, test_and_set) {
+    atomic_bool_map map(100, false);
+    ASSERT_FALSE(map.test_and_set(63));
+    ASSERT_TRUE(map.test_and_set(63));
+    ASSERT_TRUE(map[63]);
+    ASSERT_FALSE(map[62]);
+    ASSERT_FALSE(map[64]);
+}
+
+GTEST_TEST(static_map_atomic_bool, concurrent_test_and_set) {
+    const std::size_t nb_bools = 10000;
+    const std::size_t nb_threads = 4;
+    atomic_bool_map map(nb_bools, false);
+    std::vector<std::size_t> nb_claimed(nb_threads, 0);
+    {
+        std::vector<std::jthread> threads;
+        for(std::size_t t = 0; t < nb_threads; ++t)
+            threads.emplace_back([&, t]() {
+                for(std::size_t i = 0; i < nb_bools; ++i)
+                    if(!map.test_and_set((i * (t + 1)) % nb_bools))
+                        ++nb_claimed[t];
+            });
+    }
+    std::size_t total = 0;
+    for(auto && n : nb_claimed) total += n;
+    ASSERT_EQ(total, nb_bools);
+    ASSERT_TRUE(std::ranges::all_of(std::views::values(map),
+                                    [](const bool b) { return b; }));
+}
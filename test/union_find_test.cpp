@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "melon/container/union_find.hpp"
+
+#include "random_ranges_helper.hpp"
+
+using namespace fhamonic::melon;
+
+GTEST_TEST(union_find, empty_constructor) {
+    union_find uf;
+    ASSERT_TRUE(uf.empty());
+    ASSERT_EQ(uf.size(), 0);
+    ASSERT_EQ(uf.nb_components(), 0);
+    ASSERT_EQ(uf.push(), 0u);
+    ASSERT_EQ(uf.push(), 1u);
+    ASSERT_EQ(uf.nb_components(), 2);
+    ASSERT_FALSE(uf.connected(0u, 1u));
+}
+
+GTEST_TEST(union_find, join_find) {
+    union_find uf(6);
+    ASSERT_EQ(uf.size(), 6);
+    ASSERT_EQ(uf.nb_components(), 6);
+    for(unsigned k = 0; k < 6; ++k) ASSERT_EQ(uf.find(k), k);
+
+    uf.join(0u, 1u);
+    uf.join(2u, 3u);
+    ASSERT_TRUE(uf.connected(0u, 1u));
+    ASSERT_FALSE(uf.connected(1u, 2u));
+    ASSERT_EQ(uf.nb_components(), 4);
+
+    const auto root = uf.join(1u, 3u);
+    ASSERT_EQ(uf.find(0u), root);
+    ASSERT_EQ(uf.find(2u), root);
+    ASSERT_EQ(uf.component_size(3u), 4);
+    ASSERT_EQ(uf.join(0u, 2u), root);
+    ASSERT_EQ(uf.nb_components(), 3);
+    ASSERT_EQ(uf.component_size(5u), 1);
+    ASSERT_FALSE(uf.connected(4u, 5u));
+
+    uf.clear();
+    ASSERT_TRUE(uf.empty());
+}
+
+GTEST_TEST(union_find, fuzzy_test) {
+    const std::size_t n = 500;
+    auto sources = random_vector<unsigned>(300, 0, n - 1);
+    auto targets = random_vector<unsigned>(300, 0, n - 1);
+
+    union_find uf(n);
+    std::vector<std::size_t> labels(n);
+    for(std::size_t i = 0; i < n; ++i) labels[i] = i;
+    for(std::size_t i = 0; i < sources.size(); ++i) {
+        uf.join(sources[i], targets[i]);
+        const std::size_t from = labels[sources[i]], to = labels[targets[i]];
+        for(auto && l : labels)
+            if(l == from) l = to;
+    }
+    for(unsigned u = 0; u < n; ++u)
+        for(unsigned v = u; v < n; v += 7)
+            ASSERT_EQ(uf.connected(u, v), labels[u] == labels[v]);
+}
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/erdos_renyi.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+#include "melon/utility/vertex_reordering.hpp"
+
+#include "ranges_test_helper.hpp"
+
+using namespace fhamonic::melon;
+
+using vertex = vertex_t<static_digraph>;
+
+static bool is_permutation_of_vertices(const static_digraph & g,
+                                       const std::vector<vertex> & order) {
+    std::vector<vertex> sorted_order = order;
+    std::ranges::sort(sorted_order);
+    return std::ranges::equal(sorted_order, g.vertices());
+}
+
+// path 0 - 1 - ... - n-1 whose vertex ids are shuffled
+static static_digraph shuffled_path(const std::size_t n) {
+    std::vector<vertex> ids(n);
+    std::iota(ids.begin(), ids.end(), vertex{0});
+    std::shuffle(ids.begin(), ids.end(), std::mt19937{42});
+    static_digraph_builder<static_digraph> builder(n);
+    for(std::size_t i = 0; i + 1 < n; ++i) builder.add_arc(ids[i], ids[i + 1]);
+    return std::get<0>(builder.build());
+}
+
+static std::size_t arc_gap(const static_digraph & g,
+                           const arc_t<static_digraph> a) {
+    const vertex s = g.arc_source(a);
+    const vertex t = g.arc_target(a);
+    return static_cast<std::size_t>(std::max(s, t) - std::min(s, t));
+}
+
+static std::size_t bandwidth(const static_digraph & g) {
+    std::size_t max_gap = 0;
+    for(auto && a : g.arcs()) max_gap = std::max(max_gap, arc_gap(g, a));
+    return max_gap;
+}
+
+GTEST_TEST(vertex_reordering, orders_are_permutations) {
+    static_digraph graph = erdos_renyi(100, 0.05);
+    ASSERT_TRUE(is_permutation_of_vertices(graph, bfs_order(graph)));
+    ASSERT_TRUE(
+        is_permutation_of_vertices(graph, reverse_cuthill_mckee_order(graph)));
+    ASSERT_TRUE(is_permutation_of_vertices(graph, degree_order(graph)));
+    ASSERT_TRUE(is_permutation_of_vertices(graph, partition_order(graph, 8)));
+    ASSERT_TRUE(is_permutation_of_vertices(graph, partition_order(graph, 1)));
+
+    static_digraph empty_graph;
+    ASSERT_TRUE(EMPTY(bfs_order(empty_graph)));
+    ASSERT_TRUE(EMPTY(partition_order(empty_graph)));
+}
+
+GTEST_TEST(vertex_reordering, path_bandwidth) {
+    static_digraph graph = shuffled_path(200);
+    ASSERT_GT(bandwidth(graph), 1);
+    // the BFS starts inside the path and interleaves both of its sides
+    ASSERT_LE(bandwidth(reorder_vertices(graph, bfs_order(graph)).graph), 2);
+    ASSERT_EQ(bandwidth(reorder_vertices(
+                            graph, reverse_cuthill_mckee_order(graph))
+                            .graph),
+              1);
+    // sibling parts may be laid out in opposite directions, so only the arcs
+    // cut by the bisection, one per split, may be long
+    auto partitioned_graph =
+        reorder_vertices(graph, partition_order(graph, 16)).graph;
+    ASSERT_LE(std::ranges::count_if(partitioned_graph.arcs(),
+                                    [&](auto && a) {
+                                        return arc_gap(partitioned_graph, a) >
+                                               16;
+                                    }),
+              15);
+}
+
+GTEST_TEST(vertex_reordering, degree_order) {
+    static_digraph_builder<static_digraph> builder(4);
+    builder.add_arc(0, 1).add_arc(2, 0).add_arc(2, 1).add_arc(2, 3).add_arc(
+        3, 1);
+    auto [graph] = builder.build();
+    ASSERT_TRUE(EQ_RANGES(degree_order(graph), {1, 2, 0, 3}));
+}
+
+GTEST_TEST(vertex_reordering, reorder_vertices) {
+    static_digraph_builder<static_digraph, int> builder(6);
+    builder.add_arc(0, 1, 7)
+        .add_arc(0, 2, 9)
+        .add_arc(0, 5, 14)
+        .add_arc(1, 0, 7)
+        .add_arc(1, 2, 10)
+        .add_arc(1, 3, 15)
+        .add_arc(2, 0, 9)
+        .add_arc(2, 1, 10)
+        .add_arc(2, 3, 12)
+        .add_arc(2, 5, 2)
+        .add_arc(3, 1, 15)
+        .add_arc(3, 2, 12)
+        .add_arc(3, 4, 6)
+        .add_arc(4, 3, 6)
+        .add_arc(4, 5, 9)
+        .add_arc(5, 0, 14)
+        .add_arc(5, 2, 2)
+        .add_arc(5, 4, 9);
+    auto [graph, length_map] = builder.build();
+    std::vector<int> vertex_ids = {0, 10, 20, 30, 40, 50};
+
+    auto reordering = reorder_vertices(graph, std::vector<vertex>{3, 5, 0, 4, 1, 2});
+    const auto & new_graph = reordering.graph;
+    ASSERT_EQ(new_graph.nb_vertices(), graph.nb_vertices());
+    ASSERT_EQ(new_graph.nb_arcs(), graph.nb_arcs());
+    ASSERT_EQ(reordering.new_vertices[3], 0);
+    ASSERT_EQ(reordering.old_vertices[0], 3);
+    for(auto && a : new_graph.arcs()) {
+        const auto old_a = reordering.old_arcs[a];
+        ASSERT_EQ(new_graph.arc_source(a),
+                  reordering.new_vertices[graph.arc_source(old_a)]);
+        ASSERT_EQ(new_graph.arc_target(a),
+                  reordering.new_vertices[graph.arc_target(old_a)]);
+    }
+
+    auto new_length_map = reordering.permute_arc_map(length_map);
+    auto new_vertex_ids = reordering.permute_vertex_map(vertex_ids);
+    for(auto && u : new_graph.vertices())
+        ASSERT_EQ(new_vertex_ids[u], vertex_ids[reordering.old_vertices[u]]);
+
+    dijkstra alg(graph, length_map, 0);
+    dijkstra new_alg(new_graph, new_length_map, reordering.new_vertices[0]);
+    while(!alg.finished()) {
+        ASSERT_FALSE(new_alg.finished());
+        const auto [u, u_dist] = alg.current();
+        const auto [new_u, new_u_dist] = new_alg.current();
+        ASSERT_EQ(new_u, reordering.new_vertices[u]);
+        ASSERT_EQ(new_u_dist, u_dist);
+        alg.advance();
+        new_alg.advance();
+    }
+    ASSERT_TRUE(new_alg.finished());
+}